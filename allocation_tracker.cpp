@@ -0,0 +1,318 @@
+/*!
+ *  @file   allocation_tracker.cpp
+ *  @brief  mیv
+ *  @date   2018/01/30
+ */
+#include "allocation_tracker.h"
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace trading
+{
+
+namespace
+{
+enum
+{
+    MAX_THREAD_SLOT = 64,   //!< Xbhʌv̘g(ꂽXbh͍Ō̘gɂ܂Ƃ߂)
+};
+
+/*!
+ *  @brief  Xbhʌv
+ *  @note   new/delete̒ĝŊmۂ𔺂͂Ȃ
+ */
+struct ThreadSlot
+{
+    std::atomic<int64_t> m_alloc;       //!< mۉ
+    std::atomic<int64_t> m_free;        //!< 
+    std::atomic<int64_t> m_alloc_bytes; //!< mۗ[byte]
+};
+
+ThreadSlot g_thread_slot[MAX_THREAD_SLOT + 1];  //!< Xbhʌv(Ō͈p)
+std::atomic<int32_t> g_num_thread_slot(0);      //!< 蓖Ăg
+thread_local int32_t t_thread_slot = -1;        //!< ďoXbh̘gԍ(Ȃ疢蓖)
+
+/*!
+ *  @brief  ďoXbȟvg𓾂
+ *  @note   ŏɊmۂXbh珇Ɋ蓖Ă
+ */
+ThreadSlot& GetThreadSlot()
+{
+    if (t_thread_slot < 0) {
+        const int32_t slot = g_num_thread_slot.fetch_add(1);
+        t_thread_slot = (slot < MAX_THREAD_SLOT) ?slot :MAX_THREAD_SLOT;
+    }
+    return g_thread_slot[t_thread_slot];
+}
+
+/*!
+ *  @brief  vԖ𓾂
+ *  @param  section v
+ */
+const char* GetSectionName(AllocationTracker::eSection section)
+{
+    switch (section)
+    {
+    case AllocationTracker::SECTION_FRAME:          return "frame";
+    case AllocationTracker::SECTION_UPDATE:         return "update";
+    case AllocationTracker::SECTION_APPLY_RESULT:   return "apply_result";
+    case AllocationTracker::SECTION_HTML_PARSE:     return "html_parse";
+    default:                                        return "unknown";
+    }
+}
+
+} // namespace
+
+class AllocationTracker::PIMPL
+{
+private:
+    /*!
+     *  @brief  ԕʏWv
+     */
+    struct SectionStat
+    {
+        int64_t m_zero;             //!< mۂȂŏI
+        int64_t m_total_bytes;      //!< mۗʍv[byte]
+        int64_t m_max_bytes;        //!< 1񂠂őmۗ[byte]
+        LatencyHistogram m_alloc;   //!< 1񂠂mۉ
+
+        SectionStat()
+        : m_zero(0)
+        , m_total_bytes(0)
+        , m_max_bytes(0)
+        , m_alloc()
+        {
+        }
+    };
+
+    mutable std::mutex m_mtx;           //!< rq
+    SectionStat m_stat[NUM_SECTION];    //!< ԕʏWv
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+public:
+    PIMPL()
+    : m_mtx()
+    , m_stat()
+    {
+    }
+
+    /*!
+     *  @brief  Ԃ̊mۉ񐔂L^
+     *  @param  section v
+     *  @param  begin   ԊJňv
+     *  @param  end     ԏǏv
+     */
+    void Record(eSection section, const Counter& begin, const Counter& end)
+    {
+        if (section >= NUM_SECTION) {
+            return;
+        }
+        const int64_t alloc = end.m_alloc - begin.m_alloc;
+        const int64_t bytes = end.m_alloc_bytes - begin.m_alloc_bytes;
+        std::lock_guard<std::mutex> lock(m_mtx);
+        SectionStat& st(m_stat[section]);
+        if (alloc == 0) {
+            st.m_zero++;
+        }
+        st.m_total_bytes += bytes;
+        st.m_max_bytes = std::max(st.m_max_bytes, bytes);
+        st.m_alloc.Record(alloc);
+    }
+
+    /*!
+     *  @brief  Wvʏo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLog(const std::string& filename) const
+    {
+        // ʂĂ珑(oRecord҂Ȃ)
+        std::vector<SectionStat> stat;
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            stat.assign(m_stat, m_stat + NUM_SECTION);
+        }
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "section,count,zero_alloc,mean_alloc,p50_alloc,p99_alloc,max_alloc,mean_bytes,max_bytes" << std::endl;
+        for (int32_t inx = 0; inx < NUM_SECTION; inx++) {
+            const SectionStat& st(stat[inx]);
+            const int64_t count = st.m_alloc.GetCount();
+            if (count == 0) {
+                continue;
+            }
+            outputfile << GetSectionName(static_cast<eSection>(inx)) << ",";
+            outputfile << count << "," << st.m_zero << "," << st.m_alloc.GetMean() << ",";
+            outputfile << st.m_alloc.GetValueAtPercentile(50.0) << ",";
+            outputfile << st.m_alloc.GetValueAtPercentile(99.0) << ",";
+            outputfile << st.m_alloc.GetMax() << ",";
+            outputfile << st.m_total_bytes/count << "," << st.m_max_bytes << std::endl;
+        }
+        // Xbhʗ݌v(gԍ͍ŏɊmۂ/Ō̘g͈ꂽXbh̍v)
+        outputfile << "thread,alloc,free,alloc_bytes,live" << std::endl;
+        const int32_t num_slot = std::min<int32_t>(g_num_thread_slot.load(), MAX_THREAD_SLOT + 1);
+        for (int32_t inx = 0; inx < num_slot; inx++) {
+            const ThreadSlot& slot(g_thread_slot[inx]);
+            const int64_t alloc = slot.m_alloc.load(std::memory_order_relaxed);
+            const int64_t dealloc = slot.m_free.load(std::memory_order_relaxed);
+            outputfile << ((inx < MAX_THREAD_SLOT) ?std::to_string(inx) :std::string("other")) << ",";
+            outputfile << alloc << "," << dealloc << ",";
+            outputfile << slot.m_alloc_bytes.load(std::memory_order_relaxed) << ",";
+            outputfile << (alloc - dealloc) << std::endl;
+        }
+        outputfile.close();
+    }
+};
+
+//! g̎Q
+std::weak_ptr<AllocationTracker> AllocationTracker::m_pInstance;
+
+/*!
+ *  @brief  CX^X(static)
+ *  @return CX^XL|C^
+ */
+std::shared_ptr<AllocationTracker> AllocationTracker::Create()
+{
+    if (m_pInstance.lock()) {
+        std::shared_ptr<AllocationTracker> _empty_instance;
+        return _empty_instance;
+    } else {
+        std::shared_ptr<AllocationTracker> _instance(new AllocationTracker());
+        m_pInstance = _instance;
+        return _instance;
+    }
+}
+
+/*!
+ *  @brief  ďoXbh̊m/(݌v)𓾂(static)
+ *  @param[out] dst i[
+ */
+void AllocationTracker::GetThreadCounter(Counter& dst)
+{
+    const ThreadSlot& slot(GetThreadSlot());
+    dst.m_alloc = slot.m_alloc.load(std::memory_order_relaxed);
+    dst.m_free = slot.m_free.load(std::memory_order_relaxed);
+    dst.m_alloc_bytes = slot.m_alloc_bytes.load(std::memory_order_relaxed);
+}
+
+/*!
+ *  @brief  Ԃ̊mۉ񐔂L^(static)
+ *  @param  section v
+ *  @param  begin   ԊJňv
+ *  @param  end     ԏǏv
+ */
+void AllocationTracker::Record(eSection section, const Counter& begin, const Counter& end)
+{
+    std::shared_ptr<AllocationTracker> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->Record(section, begin, end);
+    }
+}
+
+/*!
+ *  @brief  Wvʏo(static)
+ *  @param  filename    o̓t@C
+ */
+void AllocationTracker::OutputLog(const std::string& filename)
+{
+    std::shared_ptr<const AllocationTracker> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->OutputLog(filename);
+    }
+}
+
+/*!
+ */
+AllocationTracker::AllocationTracker()
+: m_pImpl(new PIMPL())
+{
+}
+/*!
+ */
+AllocationTracker::~AllocationTracker()
+{
+}
+
+} // namespace trading
+
+#if defined(DEBUG_ALLOCATION_TRACKER) && (DEBUG_ALLOCATION_TRACKER != 0)
+/*!
+ *  @brief  O[onew/delete̒u
+ *  @note   ďoXbh̘gŐĂmalloc/freeɉ
+ */
+void* operator new(std::size_t size)
+{
+    trading::ThreadSlot& slot(trading::GetThreadSlot());
+    slot.m_alloc.fetch_add(1, std::memory_order_relaxed);
+    slot.m_alloc_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    for (;;) {
+        void* p = malloc(size);
+        if (p != nullptr) {
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+void operator delete(void* p) noexcept
+{
+    if (p != nullptr) {
+        trading::GetThreadSlot().m_free.fetch_add(1, std::memory_order_relaxed);
+        free(p);
+    }
+}
+void operator delete[](void* p) noexcept
+{
+    operator delete(p);
+}
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    operator delete(p);
+}
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    operator delete(p);
+}
+void operator delete(void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+void operator delete[](void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+#endif/* DEBUG_ALLOCATION_TRACKER */
@@ -0,0 +1,143 @@
+/*!
+ *  @file   allocation_tracker.h
+ *  @brief  mیv
+ *  @date   2018/01/30
+ *  @note   ԂUpdate/ł̃mۉ񐔂0ɋ߂Â邽(ƑĂȂm߂邽)̌v
+ *  @note   trade_debug.hDEBUG_ALLOCATION_TRACKER0ȂO[onew/deleteuATRADE_ALLOCATION_SCOPEߍ܂Ȃ
+ */
+#pragma once
+
+#include "trade_debug.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace trading
+{
+
+/*!
+ *  @brief  mیv
+ *  @note   singleton
+ *  @note   CX^X͖Iɐ(ďoshared_ptrŕێ)
+ *  @note   XbhƂ̊m/񐔂͒unew/delete(CX^XȂĂ)
+ *  @note   CX^X͋ԂƂ̏Wv
+ */
+class AllocationTracker
+{
+public:
+    /*!
+     *  @brief  v
+     */
+    enum eSection
+    {
+        SECTION_FRAME = 0,      //!< C[v1(UpdateMessage/o͂܂)
+        SECTION_UPDATE,         //!< Update(}V)
+        SECTION_APPLY_RESULT,   //!< MʓKp(1)
+        SECTION_HTML_PARSE,     //!< html(1)
+
+        NUM_SECTION
+    };
+
+    /*!
+     *  @brief  m/
+     */
+    struct Counter
+    {
+        int64_t m_alloc;        //!< mۉ
+        int64_t m_free;         //!< 
+        int64_t m_alloc_bytes;  //!< mۗ[byte]
+
+        Counter()
+        : m_alloc(0)
+        , m_free(0)
+        , m_alloc_bytes(0)
+        {
+        }
+    };
+
+    /*!
+     *  @brief  Ԍvq
+     *  @note   j܂ł̌ďoXbh̊mۉ񐔂1ԕƂċL^
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(eSection section)
+        : m_section(section)
+        , m_begin()
+        {
+            GetThreadCounter(m_begin);
+        }
+        ~Scope()
+        {
+            Counter end;
+            GetThreadCounter(end);
+            Record(m_section, m_begin, end);
+        }
+
+    private:
+        Scope(const Scope&);
+        Scope& operator= (const Scope&);
+
+        eSection m_section; //!< v
+        Counter m_begin;    //!< ԊJňv
+    };
+
+    /*!
+     *  @brief  CX^X + 
+     *  @return CX^XL|C^
+     *  @note   ς݂Ȃshared_ptrԂ
+     */
+    static std::shared_ptr<AllocationTracker> Create();
+
+    /*!
+     *  @brief  ďoXbh̊m/(݌v)𓾂
+     *  @param[out] dst i[
+     */
+    static void GetThreadCounter(Counter& dst);
+
+    /*!
+     *  @brief  Ԃ̊mۉ񐔂L^
+     *  @param  section v
+     *  @param  begin   ԊJňv
+     *  @param  end     ԏǏv
+     */
+    static void Record(eSection section, const Counter& begin, const Counter& end);
+
+    /*!
+     *  @brief  Wvʏo
+     *  @param  filename    o̓t@C
+     *  @note   csv`(ԕʂ1񂠂mۉ񐔂ƁAXbhʂ̗݌v)
+     *  @note   Wv͎ʂĂ珑o(ov͎~߂Ȃ)/t@Co͂͏d̂ŔXbh͌Ă΂Ȃ
+     */
+    static void OutputLog(const std::string& filename);
+
+    /*!
+     */
+    ~AllocationTracker();
+
+private:
+    AllocationTracker();
+    AllocationTracker(const AllocationTracker&);
+    AllocationTracker(AllocationTracker&&);
+    AllocationTracker& operator= (const AllocationTracker&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+
+    //! g̎Q
+    static std::weak_ptr<AllocationTracker> m_pInstance;
+};
+
+} // namespace trading
+
+#if defined(DEBUG_ALLOCATION_TRACKER) && (DEBUG_ALLOCATION_TRACKER != 0)
+#define TRADE_ALLOCATION_SCOPE_NAME2(line)  trade_allocation_scope_##line
+#define TRADE_ALLOCATION_SCOPE_NAME(line)   TRADE_ALLOCATION_SCOPE_NAME2(line)
+//! mۉ񐔌v(XR[v𔲂܂)
+#define TRADE_ALLOCATION_SCOPE(section) \
+    const trading::AllocationTracker::Scope TRADE_ALLOCATION_SCOPE_NAME(__LINE__)(trading::AllocationTracker::section)
+#else
+#define TRADE_ALLOCATION_SCOPE(section)
+#endif/* DEBUG_ALLOCATION_TRACKER */
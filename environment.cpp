@@ -80,6 +80,10 @@ const garnet::twitter_config_ref Environment::GetTwitterConfig()
 Environment::Environment()
 : m_python_config()
 , m_trading_script()
+, m_trading_thread_cpu()
+, m_network_thread_cpu()
+, m_worker_thread_cpu()
+, m_trading_thread_fifo_priority(0)
 {
 }
 
@@ -107,4 +111,9 @@ void Environment::initialize()
         boost::optional<std::string> str = pt.get_optional<std::string>("Script.TradingScript");
         m_trading_script = str.get();
     }
+    // Xbhzu(ȗ)
+    m_trading_thread_cpu = pt.get<std::string>("Thread.TradingCPU", std::string());
+    m_network_thread_cpu = pt.get<std::string>("Thread.NetworkCPU", std::string());
+    m_worker_thread_cpu = pt.get<std::string>("Thread.WorkerCPU", std::string());
+    m_trading_thread_fifo_priority = pt.get<int32_t>("Thread.TradingFIFOPriority", 0);
 }
@@ -10,6 +10,7 @@
 #include "python/python_config_fwd.h"
 #include "twitter/twitter_config_fwd.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -53,6 +54,25 @@ public:
      */
     std::string GetTradingScript() const { return m_trading_script; }
 
+    /*!
+     *  @brief  XbhŒ肷CPUԍXg𓾂
+     *  @note   "0,2-3"`/ȂŒ肵Ȃ
+     */
+    std::string GetTradingThreadCPU() const { return m_trading_thread_cpu; }
+    /*!
+     *  @brief  ʐMXbhŒ肷CPUԍXg𓾂
+     */
+    std::string GetNetworkThreadCPU() const { return m_network_thread_cpu; }
+    /*!
+     *  @brief  /Oo̓XbhŒ肷CPUԍXg𓾂
+     */
+    std::string GetWorkerThreadCPU() const { return m_worker_thread_cpu; }
+    /*!
+     *  @brief  XbhSCHED_FIFODx𓾂
+     *  @note   0ȂSCHED_FIFOɂȂ(linux̂ݗL)
+     */
+    int32_t GetTradingThreadFIFOPriority() const { return m_trading_thread_fifo_priority; }
+
 private:
     Environment();
     Environment(const Environment&);
@@ -66,6 +86,14 @@ private:
 
     //! g[fBOXNvg
     std::string m_trading_script;
+    //! XbhŒ肷CPUԍXg
+    std::string m_trading_thread_cpu;
+    //! ʐMXbhŒ肷CPUԍXg
+    std::string m_network_thread_cpu;
+    //! /Oo̓XbhŒ肷CPUԍXg
+    std::string m_worker_thread_cpu;
+    //! XbhSCHED_FIFODx
+    int32_t m_trading_thread_fifo_priority;
     //! GoogleCalendarAPIݒ
     garnet::GoogleCalendarAPIConfigPtr m_google_calendar_api_config;
     //! pythonݒ  
@@ -0,0 +1,280 @@
+/*!
+ *  @file   html_parse_worker.cpp
+ *  @brief  html͐pXbh
+ *  @date   2018/01/26
+ */
+#include "html_parse_worker.h"
+
+#include "allocation_tracker.h"
+#include "scope_profiler.h"
+#include "thread_affinity.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace trading
+{
+
+class HtmlParseWorker::PIMPL
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    /*!
+     *  @brief  ҂svf
+     */
+    struct QueuedTask
+    {
+        Task m_task;                    //!< ͏
+        FailTask m_fail;                //!< s
+        clock::time_point m_post_time;  //!< 
+
+        QueuedTask(const Task& task, const FailTask& fail, const clock::time_point& post_time)
+        : m_task(task)
+        , m_fail(fail)
+        , m_post_time(post_time)
+        {
+        }
+    };
+
+    const size_t m_capacity;            //!< ҂s
+    mutable std::mutex m_mtx;           //!< rq
+    std::condition_variable m_cond;     //!< /Iʒm
+    std::deque<QueuedTask> m_queue;     //!< ҂s
+    bool m_b_terminate;                 //!< Iv
+    Statistics m_stat;                  //!< v
+    std::vector<std::thread> m_thread;  //!< ̓Xbh
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  oߎ[}CNb]
+     */
+    static int64_t ElapsedMicroSeconds(const clock::time_point& begin, const clock::time_point& end)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    }
+
+    /*!
+     *  @brief  Ԃ𓝌vɉ
+     *  @param  wait_us     ҂[}CNb]
+     *  @param  parse_us    [}CNb]
+     */
+    void AddTime(int64_t wait_us, int64_t parse_us)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stat.m_total_wait_us += wait_us;
+        m_stat.m_max_wait_us = std::max(m_stat.m_max_wait_us, wait_us);
+        m_stat.m_total_parse_us += parse_us;
+        m_stat.m_max_parse_us = std::max(m_stat.m_max_parse_us, parse_us);
+    }
+
+    /*!
+     *  @brief  s𐔂
+     */
+    void CountFail()
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stat.m_fail++;
+    }
+
+    /*!
+     *  @brief  sēvƂ
+     *  @param  task        ͏
+     *  @param  fail        s
+     *  @param  post_time   
+     *  @note   O͂Ŏ~߂(̓Xbhostd::terminateɂȂ)
+     */
+    void Execute(const Task& task, const FailTask& fail, const clock::time_point& post_time)
+    {
+        const clock::time_point begin = clock::now();
+        {
+            TRADE_PROFILE_SCOPE(PHASE_HTML_PARSE);
+            TRADE_ALLOCATION_SCOPE(SECTION_HTML_PARSE);
+            try {
+                task();
+            } catch (...) {
+                CountFail();
+                if (fail) {
+                    const std::exception_ptr e = std::current_exception();
+                    try {
+                        fail(e);
+                    } catch (...) {
+                        // s̎s͒߂
+                    }
+                }
+            }
+        }
+        const clock::time_point end = clock::now();
+        AddTime(ElapsedMicroSeconds(post_time, begin), ElapsedMicroSeconds(begin, end));
+    }
+
+    /*!
+     *  @brief  ̓Xbh
+     */
+    void Run()
+    {
+        thread_affinity::ApplyCurrentThread(thread_affinity::ROLE_WORKER);
+        for (;;) {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_cond.wait(lock, [this]() { return m_b_terminate || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                return; // Iv(cȂ)
+            }
+            QueuedTask qtask(std::move(m_queue.front()));
+            m_queue.pop_front();
+            lock.unlock();
+            //
+            Execute(qtask.m_task, qtask.m_fail, qtask.m_post_time);
+        }
+    }
+
+public:
+    PIMPL(int32_t num_thread, int32_t capacity)
+    : m_capacity(static_cast<size_t>(std::max(capacity, 1)))
+    , m_mtx()
+    , m_cond()
+    , m_queue()
+    , m_b_terminate(false)
+    , m_stat()
+    , m_thread()
+    {
+        for (int32_t inx = 0; inx < num_thread; inx++) {
+            m_thread.emplace_back([this]() { Run(); });
+        }
+    }
+    ~PIMPL()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_b_terminate = true;
+        }
+        m_cond.notify_all();
+        for (auto& th: m_thread) {
+            th.join();
+        }
+    }
+
+    /*!
+     *  @brief  ͏
+     *  @param  task    ͏
+     *  @param  fail    s
+     */
+    void Post(const Task& task, const FailTask& fail)
+    {
+        const clock::time_point post_time = clock::now();
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_stat.m_post++;
+            if (!m_thread.empty() && m_queue.size() < m_capacity) {
+                m_queue.emplace_back(task, fail, post_time);
+                m_stat.m_max_depth = std::max(m_stat.m_max_depth, static_cast<int64_t>(m_queue.size()));
+                m_cond.notify_one();
+                return;
+            }
+            if (!m_thread.empty()) {
+                m_stat.m_overflow++;
+            }
+        }
+        // XbhȂ or ꂽ  XbhŎs
+        Execute(task, fail, post_time);
+    }
+
+    /*!
+     *  @brief  ͏ȗ𐔂
+     */
+    void CountSkip()
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stat.m_skip++;
+    }
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(Statistics& dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        dst = m_stat;
+    }
+
+    /*!
+     *  @brief  vo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLog(const std::string& filename) const
+    {
+        Statistics st;
+        GetStatistics(st);
+        //
+        const int64_t ave_wait_us = (st.m_post > 0) ?st.m_total_wait_us/st.m_post :0;
+        const int64_t ave_parse_us = (st.m_post > 0) ?st.m_total_parse_us/st.m_post :0;
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "thread,post,overflow,skip,fail,max_depth,ave_wait_us,max_wait_us,ave_parse_us,max_parse_us" << std::endl;
+        outputfile << m_thread.size() << "," << st.m_post << "," << st.m_overflow << "," << st.m_skip << ",";
+        outputfile << st.m_fail << ",";
+        outputfile << st.m_max_depth << "," << ave_wait_us << "," << st.m_max_wait_us << ",";
+        outputfile << ave_parse_us << "," << st.m_max_parse_us << std::endl;
+        outputfile.close();
+    }
+};
+
+/*!
+ *  @param  num_thread  Xbh(0ȂɓXbhŎs)
+ *  @param  capacity    ҂s
+ */
+HtmlParseWorker::HtmlParseWorker(int32_t num_thread, int32_t capacity)
+: m_pImpl(new PIMPL(num_thread, capacity))
+{
+}
+/*!
+ */
+HtmlParseWorker::~HtmlParseWorker()
+{
+}
+
+/*!
+ *  @brief  ͏
+ *  @param  task    ͏
+ *  @param  fail    s(taskO𓊂Ă)
+ */
+void HtmlParseWorker::Post(const Task& task, const FailTask& fail)
+{
+    m_pImpl->Post(task, fail);
+}
+
+/*!
+ *  @brief  ͏ȗ𐔂
+ */
+void HtmlParseWorker::CountSkip()
+{
+    m_pImpl->CountSkip();
+}
+
+/*!
+ *  @brief  v擾
+ *  @param[out] dst i[
+ */
+void HtmlParseWorker::GetStatistics(Statistics& dst) const
+{
+    m_pImpl->GetStatistics(dst);
+}
+
+/*!
+ *  @brief  vo
+ *  @param  filename    o̓t@C
+ */
+void HtmlParseWorker::OutputLog(const std::string& filename) const
+{
+    m_pImpl->OutputLog(filename);
+}
+
+} // namespace trading
@@ -0,0 +1,105 @@
+/*!
+ *  @file   html_parse_worker.h
+ *  @brief  html͐pXbh
+ *  @date   2018/01/26
+ *  @note   httpXbh(cpprest̃Xbhv[)ŏd͂Ȃ悤͂肷
+ */
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace trading
+{
+
+/*!
+ *  @brief  html͐pXbhNX
+ *  @note   t҂sɐς܂ꂽ͏pXbhŏɎs
+ *  @note   ҂s񂪈ꂽ瓊Xbhł̂܂܎s(̂ĂȂ)
+ *  @note   ͏O̓Xbh̊O֏oAsɓn
+ */
+class HtmlParseWorker
+{
+public:
+    /*!
+     *  @brief  v
+     */
+    struct Statistics
+    {
+        int64_t m_post;             //!< 
+        int64_t m_overflow;         //!< ēXbhŎs
+        int64_t m_skip;             //!< eOƓŉ͂ȗ
+        int64_t m_fail;             //!< OŎs
+        int64_t m_max_depth;        //!< ő҂s
+        int64_t m_total_wait_us;    //!< ҂ԍv[}CNb]
+        int64_t m_max_wait_us;      //!< ő҂[}CNb]
+        int64_t m_total_parse_us;   //!< ԍv[}CNb]
+        int64_t m_max_parse_us;     //!< ő又[}CNb]
+
+        Statistics()
+        : m_post(0)
+        , m_overflow(0)
+        , m_skip(0)
+        , m_fail(0)
+        , m_max_depth(0)
+        , m_total_wait_us(0)
+        , m_max_wait_us(0)
+        , m_total_parse_us(0)
+        , m_max_parse_us(0)
+        {
+        }
+    };
+
+    //! ͏ {̂container_bufferƃLv`ēn(Rs[Ȃ)
+    typedef std::function<void()> Task;
+    //! s ͏O󂯎(vԂ̉⎸s̒ʒms)
+    typedef std::function<void(const std::exception_ptr&)> FailTask;
+
+    /*!
+     *  @param  num_thread  Xbh(0ȂɓXbhŎs)
+     *  @param  capacity    ҂s
+     */
+    HtmlParseWorker(int32_t num_thread, int32_t capacity);
+    /*!
+     *  @note   ҂sɎcĂ鏈IĂXbh~߂
+     */
+    ~HtmlParseWorker();
+
+    /*!
+     *  @brief  ͏
+     *  @param  task    ͏
+     *  @param  fail    s(taskO𓊂Ă)
+     */
+    void Post(const Task& task, const FailTask& fail);
+    /*!
+     *  @brief  ͏ȗ𐔂
+     *  @note   ͏̒ŉ{̂OƓƔɌĂ
+     */
+    void CountSkip();
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(Statistics& dst) const;
+
+    /*!
+     *  @brief  vo
+     *  @param  filename    o̓t@C
+     *  @note   csv`
+     */
+    void OutputLog(const std::string& filename) const;
+
+private:
+    HtmlParseWorker(const HtmlParseWorker&);
+    HtmlParseWorker(HtmlParseWorker&&);
+    HtmlParseWorker& operator= (const HtmlParseWorker&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
@@ -0,0 +1,1193 @@
+/*!
+ *  @file   html_parser_sbi.cpp
+ *  @brief  SBI،TCghtml(native)
+ *  @date   2018/01/25
+ */
+#include "html_parser_sbi.h"
+
+#include "stock_portfolio.h"
+#include "trade_datetime.h"
+#include "trade_struct.h"
+
+#include "garnet_time.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace trading
+{
+namespace html_parser_sbi
+{
+
+namespace
+{
+
+/*!
+ *  @brief  html
+ *  @note   obt@w(Rs[Ȃ)
+ */
+struct HtmlToken
+{
+    enum eType
+    {
+        TOKEN_NONE = 0,
+        TOKEN_START_TAG,    //!< Jn^O
+        TOKEN_END_TAG,      //!< I^O
+        TOKEN_TEXT,         //!< eLXgf[^
+    };
+
+    eType m_type;           //!< 
+    const char* m_name;     //!< ^O
+    size_t m_name_len;      //!< ^O
+    const char* m_body;     //!< ^O: / eLXg:{
+    size_t m_body_len;      //!< ̒
+
+    HtmlToken()
+    : m_type(TOKEN_NONE)
+    , m_name(nullptr)
+    , m_name_len(0)
+    , m_body(nullptr)
+    , m_body_len(0)
+    {
+    }
+
+    /*!
+     *  @brief  ^Or
+     *  @param  name    ^O()
+     *  @note   啶͋ʂȂ
+     */
+    bool IsTag(const char* name) const
+    {
+        const size_t len = strlen(name);
+        if (len != m_name_len) {
+            return false;
+        }
+        for (size_t inx = 0; inx < len; inx++) {
+            if (tolower(static_cast<unsigned char>(m_name[inx])) != name[inx]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    bool IsStartTag(const char* name) const { return m_type == TOKEN_START_TAG && IsTag(name); }
+    bool IsEndTag(const char* name) const { return m_type == TOKEN_END_TAG && IsTag(name); }
+
+    /*!
+     *  @brief  {擾(eLXgp)
+     */
+    std::string GetText() const { return std::string(m_body, m_body_len); }
+
+    /*!
+     *  @brief  l擾
+     *  @param[in]  key ()
+     *  @param[out] dst i[
+     *  @retval true    
+     */
+    bool GetAttribute(const char* key, std::string& dst) const
+    {
+        const size_t key_len = strlen(key);
+        const char* p = m_body;
+        const char* end = m_body + m_body_len;
+        while (p < end) {
+            while (p < end && (isspace(static_cast<unsigned char>(*p)) || *p == '/')) {
+                p++;
+            }
+            const char* nm_begin = p;
+            while (p < end && *p != '=' && *p != '/' && !isspace(static_cast<unsigned char>(*p))) {
+                p++;
+            }
+            const char* nm_end = p;
+            while (p < end && isspace(static_cast<unsigned char>(*p))) {
+                p++;
+            }
+            const char* val_begin = p;
+            const char* val_end = p;
+            if (p < end && *p == '=') {
+                p++;
+                while (p < end && isspace(static_cast<unsigned char>(*p))) {
+                    p++;
+                }
+                if (p < end && (*p == '"' || *p == '\'')) {
+                    // Shift-JIS2byteڂpƈv邱Ƃ͂Ȃ
+                    const char quote = *p++;
+                    val_begin = p;
+                    while (p < end && *p != quote) {
+                        p++;
+                    }
+                    val_end = p;
+                    if (p < end) {
+                        p++;
+                    }
+                } else {
+                    val_begin = p;
+                    while (p < end && !isspace(static_cast<unsigned char>(*p))) {
+                        p++;
+                    }
+                    val_end = p;
+                }
+            }
+            if (nm_end == nm_begin) {
+                continue;
+            }
+            if (static_cast<size_t>(nm_end - nm_begin) == key_len) {
+                bool b_match = true;
+                for (size_t inx = 0; inx < key_len; inx++) {
+                    if (tolower(static_cast<unsigned char>(nm_begin[inx])) != key[inx]) {
+                        b_match = false;
+                        break;
+                    }
+                }
+                if (b_match) {
+                    dst.assign(val_begin, val_end);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+/*!
+ *  @brief  html͊
+ *  @note   python(HTMLParser)݊̍ŏ̎
+ *  @note   ERg/錾͓ǂݔ΂
+ *  @note   Escript/style̒g͓ǂݔ΂
+ *  @note   EQ(&xxx;)͓ǂݔ΂ăeLXg𕪊(handle_entityrefĂȂpythonłƓ)
+ *  @note   '<' '>' '&' '"' Shift-JIS/UTF-82byteڈȍ~ɌȂ̂ŃoCgPʂőėǂ
+ */
+class HtmlTokenizer
+{
+private:
+    const char* m_cur;  //!< ʒu
+    const char* m_end;  //!< I[
+
+    /*!
+     *  @brief  񌟍
+     *  @param  begin
+     *  @param  key
+     *  @return ʒu(Ȃm_end)
+     */
+    const char* Search(const char* begin, const char* key) const
+    {
+        const size_t key_len = strlen(key);
+        for (const char* p = begin; p + key_len <= m_end; p++) {
+            if (memcmp(p, key, key_len) == 0) {
+                return p;
+            }
+        }
+        return m_end;
+    }
+    /*!
+     *  @brief  I^O(啶ʂȂ)
+     *  @param  begin
+     *  @param  name    ^O()
+     */
+    const char* SearchEndTag(const char* begin, const char* name) const
+    {
+        const size_t name_len = strlen(name);
+        for (const char* p = begin; p + name_len + 2 <= m_end; p++) {
+            if (p[0] != '<' || p[1] != '/') {
+                continue;
+            }
+            bool b_match = true;
+            for (size_t inx = 0; inx < name_len; inx++) {
+                if (tolower(static_cast<unsigned char>(p[2+inx])) != name[inx]) {
+                    b_match = false;
+                    break;
+                }
+            }
+            if (b_match) {
+                return p;
+            }
+        }
+        return m_end;
+    }
+    /*!
+     *  @brief  QƂǂݔ΂
+     *  @param  p   '&'̈ʒu
+     *  @return ǂݔ΂̈ʒu(QƂłȂp)
+     */
+    const char* SkipCharRef(const char* p) const
+    {
+        const char* q = p + 1;
+        if (q < m_end && *q == '#') {
+            q++;
+        }
+        const char* name_begin = q;
+        while (q < m_end && isalnum(static_cast<unsigned char>(*q))) {
+            q++;
+        }
+        if (q == name_begin) {
+            return p;
+        }
+        if (q < m_end && *q == ';') {
+            q++;
+        }
+        return q;
+    }
+
+public:
+    HtmlTokenizer(const std::string& src)
+    : m_cur(src.data())
+    , m_end(src.data() + src.size())
+    {
+    }
+
+    /*!
+     *  @brief  ̎𓾂
+     *  @param[out] dst i[
+     *  @retval false   I[ɒB
+     */
+    bool Next(HtmlToken& dst)
+    {
+        while (m_cur < m_end) {
+            if (*m_cur == '&') {
+                const char* p = SkipCharRef(m_cur);
+                if (p != m_cur) {
+                    m_cur = p;
+                    continue;
+                }
+            }
+            if (*m_cur != '<') {
+                // eLXg
+                const char* p = m_cur + 1;
+                while (p < m_end && *p != '<' && *p != '&') {
+                    p++;
+                }
+                dst.m_type = HtmlToken::TOKEN_TEXT;
+                dst.m_name = nullptr;
+                dst.m_name_len = 0;
+                dst.m_body = m_cur;
+                dst.m_body_len = p - m_cur;
+                m_cur = p;
+                return true;
+            }
+            if (m_end - m_cur >= 4 && memcmp(m_cur, "<!--", 4) == 0) {
+                // Rg
+                const char* p = Search(m_cur + 4, "-->");
+                m_cur = (p == m_end) ?m_end :p + 3;
+                continue;
+            }
+            if (m_cur + 1 < m_end && (m_cur[1] == '!' || m_cur[1] == '?')) {
+                // 錾/
+                const char* p = static_cast<const char*>(memchr(m_cur, '>', m_end - m_cur));
+                m_cur = (p == nullptr) ?m_end :p + 1;
+                continue;
+            }
+            const bool b_end_tag = (m_cur + 1 < m_end && m_cur[1] == '/');
+            const char* name_begin = m_cur + (b_end_tag ?2 :1);
+            const char* name_end = name_begin;
+            while (name_end < m_end && isalnum(static_cast<unsigned char>(*name_end))) {
+                name_end++;
+            }
+            if (name_end == name_begin) {
+                // ^Oł͂Ȃ'<'̓eLXg
+                const char* p = m_cur + 1;
+                while (p < m_end && *p != '<' && *p != '&') {
+                    p++;
+                }
+                dst.m_type = HtmlToken::TOKEN_TEXT;
+                dst.m_name = nullptr;
+                dst.m_name_len = 0;
+                dst.m_body = m_cur;
+                dst.m_body_len = p - m_cur;
+                m_cur = p;
+                return true;
+            }
+            // ^OI[('>')T p'>'͖
+            const char* p = name_end;
+            char quote = 0;
+            while (p < m_end) {
+                if (quote != 0) {
+                    if (*p == quote) {
+                        quote = 0;
+                    }
+                } else if (*p == '"' || *p == '\'') {
+                    quote = *p;
+                } else if (*p == '>') {
+                    break;
+                }
+                p++;
+            }
+            dst.m_type = (b_end_tag) ?HtmlToken::TOKEN_END_TAG :HtmlToken::TOKEN_START_TAG;
+            dst.m_name = name_begin;
+            dst.m_name_len = name_end - name_begin;
+            dst.m_body = name_end;
+            dst.m_body_len = p - name_end;
+            m_cur = (p == m_end) ?m_end :p + 1;
+            if (!b_end_tag) {
+                // script/style̒g͓ǂݔ΂(I^O͎ɕԂ)
+                if (dst.IsTag("script")) {
+                    m_cur = SearchEndTag(m_cur, "script");
+                } else if (dst.IsTag("style")) {
+                    m_cur = SearchEndTag(m_cur, "style");
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+};
+
+/*!
+ *  @brief  ܂ނ
+ *  @param  src
+ *  @param  key
+ */
+bool Contains(const std::string& src, const char* key)
+{
+    return src.find(key) != std::string::npos;
+}
+
+/*!
+ *  @brief  l
+ *  @param  src ','ςݕ
+ *  @note   pythonisNumber(󕶎false)
+ */
+bool IsNumber(const std::string& src)
+{
+    if (src.empty()) {
+        return false;
+    }
+    for (const char c: src) {
+        if (!isdigit(static_cast<unsigned char>(c)) && c != '.') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ *  @brief  liɕϊ
+ *  @param  src ','ςݕ
+ *  @note   lłȂ-1
+ */
+float64 ToValue(const std::string& src)
+{
+    if (!IsNumber(src)) {
+        return -1.0;
+    }
+    return strtod(src.c_str(), nullptr);
+}
+
+/*!
+ *  @brief  |[gtHI
+ */
+enum ePortfolioColumn
+{
+    PFCOL_NONE = 0,
+    PFCOL_CODE,     //!< 
+    PFCOL_VALUE,    //!< ݒl
+    PFCOL_VOLUME,   //!< o
+    PFCOL_OPEN,     //!< nl
+    PFCOL_HIGH,     //!< l
+    PFCOL_LOW,      //!< l
+    PFCOL_CLOSE,    //!< OIl
+};
+
+/*!
+ *  @brief  ږ|[gtHIڂ𓾂
+ *  @param  name    ږ(Shift-JIS)
+ *  @note   菇pythonłƓ
+ */
+ePortfolioColumn ToPortfolioColumn(const std::string& name)
+{
+    if (Contains(name, "")) {
+        return PFCOL_CODE;
+    } else if (Contains(name, "ݒl")) {
+        return PFCOL_VALUE;
+    } else if (Contains(name, "o")) {
+        return PFCOL_VOLUME;
+    } else if (Contains(name, "nl")) {
+        return PFCOL_OPEN;
+    } else if (Contains(name, "l")) {
+        return PFCOL_HIGH;
+    } else if (Contains(name, "l")) {
+        return PFCOL_LOW;
+    } else if (Contains(name, "OIl")) {
+        return PFCOL_CLOSE;
+    }
+    return PFCOL_NONE;
+}
+
+/*!
+ *  @brief  ݂̂ō\ꂽ
+ *  @param  src
+ *  @note   pythonstr.isdigit
+ */
+bool IsDigitString(const std::string& src)
+{
+    if (src.empty()) {
+        return false;
+    }
+    for (const char c: src) {
+        if (!isdigit(static_cast<unsigned char>(c))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ *  @brief  Sč폜
+ *  @param[out] src Ώە
+ *  @param[in]  key 폜镶
+ */
+void EraseString(std::string& src, const char* key)
+{
+    const size_t key_len = strlen(key);
+    for (size_t pos = src.find(key); pos != std::string::npos; pos = src.find(key, pos)) {
+        src.erase(pos, key_len);
+    }
+}
+
+/*!
+ *  @brief  /mFʂ̃^Cg
+ *  @param  data    title^ÕeLXg(UTF-8)
+ *  @param  type    
+ *  @param  title   ʖ(UTF-8)
+ *  @note   pythonStockOrderRegistIDParserƓ
+ */
+bool IsStockOrderTitle(const std::string& data, eOrderType type, const char* title)
+{
+    switch (type)
+    {
+    case ORDER_BUY:
+    case ORDER_REPBUY:
+        // ʂ̑S/pɕ\Lꂪc
+        return Contains(data, title) &&
+               (Contains(data, u8")") || Contains(data, u8"j") || Contains(data, u8"PTS)"));
+    case ORDER_SELL:
+    case ORDER_REPSELL:
+        return Contains(data, title) &&
+               (Contains(data, u8")") || Contains(data, u8"j") || Contains(data, u8"PTS)"));
+    case ORDER_CORRECT:
+        return Contains(data, u8"");
+    case ORDER_CANCEL:
+        return Contains(data, u8"");
+    default:
+        return false;
+    }
+}
+
+/*!
+ *  @brief  regist_id؂o(SBI-mobile[obNAbv]TCgp)
+ *  @param  html_u8 /mFresponse(html/UTF-8)
+ *  @param  type    
+ *  @param  title   ʖ(UTF-8)
+ *  @return regist_id(Ȃ-1)
+ *  @note   html_parser_sbi.py:StockOrderRegistIDParser
+ *  @note   regist_id𓾂_őł؂(ȍ~𑖍Ăʂ͕ςȂ)
+ */
+int64_t GetStockOrderRegistIDCore(const std::string& html_u8, eOrderType type, const char* title)
+{
+    bool b_ok = false;      // Ӑ}htmlł邱ƂmFłtrue
+    bool b_start = false;   // Jn^OȂtrue
+    HtmlToken tag_now;      // ߂̊Jn^O
+    std::string name;
+    std::string value;
+
+    HtmlTokenizer tokenizer(html_u8);
+    HtmlToken token;
+    while (tokenizer.Next(token)) {
+        switch (token.m_type)
+        {
+        case HtmlToken::TOKEN_START_TAG:
+            tag_now = token;
+            b_start = true;
+            if (b_ok && token.IsTag("input")) {
+                if (token.GetAttribute("name", name) && token.GetAttribute("value", value) && name == "regist_id") {
+                    const int64_t regist_id = strtoll(value.c_str(), nullptr, 10);
+                    if (regist_id > 0) {
+                        return regist_id;
+                    }
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_TEXT:
+            if (!b_ok && b_start && tag_now.IsTag("title")) {
+                b_ok = IsStockOrderTitle(token.GetText(), type, title);
+            }
+            b_start = false;
+            break;
+
+        default:
+            break;
+        }
+    }
+    return -1;
+}
+
+/*!
+ *  @brief  ʂtdf[^ϊ
+ *  @param[in]  td_data tdf[^(UTF-8)
+ *  @param[out] dst     i[
+ *  @note   [0]R[h/[1]/2ȍ~͋^OAl
+ */
+void ConvertStockOrderExecTD(const std::vector<std::string>& td_data, RcvResponseStockOrder& dst)
+{
+    const size_t td_data_len = td_data.size();
+    for (size_t inx = 0; inx < td_data_len; inx++) {
+        if (inx == 0) {
+            dst.m_code = static_cast<uint32_t>(strtoul(td_data[inx].c_str(), nullptr, 10));
+        } else if (inx == 1) {
+            if (Contains(td_data[inx], u8"")) {
+                dst.m_investments = INVESTMENTS_TOKYO;
+            } else if (Contains(td_data[inx], "PTS")) {
+                dst.m_investments = INVESTMENTS_PTS;
+            } else {
+                dst.m_investments = INVESTMENTS_NONE;
+            }
+        } else if ((inx & 1) == 0 && inx + 1 < td_data_len) {
+            const std::string& tag(td_data[inx]);
+            std::string value(td_data[inx+1]);
+            if (Contains(tag, u8"") || Contains(tag, u8"")) {
+                if (!Contains(tag, u8"㔄p")) { // vO
+                    EraseString(value, u8"");
+                    EraseString(value, ",");
+                    dst.m_number = static_cast<int32_t>(strtol(value.c_str(), nullptr, 10));
+                }
+            }
+            if (Contains(tag, u8"i")) {
+                if (value == u8"s") {
+                    dst.m_value = -1.0;
+                } else {
+                    // 's/468~' ݂Ȃ(iw+t)
+                    const size_t pos = value.find('/');
+                    if (pos != std::string::npos) {
+                        value = value.substr(pos + 1, value.find('/', pos + 1) - (pos + 1));
+                    }
+                    EraseString(value, u8"~");
+                    EraseString(value, ",");
+                    dst.m_value = strtod(value.c_str(), nullptr);
+                }
+            }
+            if (Contains(tag, u8"")) {
+                dst.m_b_leverage = Contains(value, u8"Mp");
+            }
+        }
+    }
+}
+
+/*!
+ *  @brief  tdf[^񂩂keyTindexԂ
+ *  @param  src tdf[^(łȂ)
+ *  @param  key Tkey
+ *  @note   pythonsearchTdDataTag
+ *  @note   ȂΖԂ(pythonł-1listQƂɂȂ̂Ɠ)
+ */
+size_t SearchTdDataTag(const std::vector<std::string>& src, const char* key)
+{
+    for (size_t inx = 0; inx < src.size(); inx++) {
+        if (src[inx] == key) {
+            return inx;
+        }
+    }
+    return src.size() - 1;
+}
+
+/*!
+ *  @brief  Xy[XEsŕ
+ *  @param[in]  src
+ *  @param[out] dst i[
+ *  @note   pythonsplitBySPCRLF
+ */
+void SplitBySpaceCRLF(const std::string& src, std::vector<std::string>& dst)
+{
+    size_t begin = 0;
+    while (begin <= src.size()) {
+        size_t end = src.find_first_of(" \n", begin);
+        if (end == std::string::npos) {
+            end = src.size();
+        }
+        if (end > begin) {
+            std::string elem(src, begin, end - begin);
+            if (elem != "\r") {
+                dst.emplace_back(std::move(elem));
+            }
+        }
+        begin = end + 1;
+    }
+}
+
+/*!
+ *  @brief  SBIʕ񂩂璍ʂ𓾂
+ *  @param[in]  src         ʕ
+ *  @param[out] type        
+ *  @param[out] b_leverage  MptO
+ *  @note   pythoneOrderTypeEnum.getOrderTypeFromStr
+ */
+void ToOrderTypeFromSbiStr(const std::string& src, eOrderType& type, bool& b_leverage)
+{
+    static const struct
+    {
+        const char* m_key;
+        eOrderType m_type;
+        bool m_b_leverage;
+    } order_type_str[] = {
+        { "", ORDER_BUY,     false },
+        { "", ORDER_SELL,    false },
+        { "MV", ORDER_BUY,     true },
+        { "MV", ORDER_SELL,    true },
+        { "MԔ", ORDER_REPSELL, true },
+        { "MԔ", ORDER_REPBUY,  true },
+    };
+    for (const auto& ots: order_type_str) {
+        if (Contains(src, ots.m_key)) {
+            type = ots.m_type;
+            b_leverage = ots.m_b_leverage;
+            return;
+        }
+    }
+    type = ORDER_NONE;
+    b_leverage = false;
+}
+
+const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;   //!< FNV-1al
+const uint64_t FNV_PRIME = 0x100000001b3ULL;                //!< FNV-1a搔
+
+/*!
+ *  @brief  nbV(FNV-1a/64bit)ݍ
+ *  @param  seed    l(vZς݂̃nbV)
+ *  @param  src
+ *  @note   ̋؂ݍ(AʒuႤ̂ʂ邽)
+ */
+uint64_t HashString(uint64_t seed, const std::string& src)
+{
+    for (const char c: src) {
+        seed ^= static_cast<unsigned char>(c);
+        seed *= FNV_PRIME;
+    }
+    seed ^= 0xff;
+    seed *= FNV_PRIME;
+    return seed;
+}
+
+} // namespace
+
+/*!
+ *  @brief  |[gtHI؂o(SBI-PC[C]TCgp)/Ď
+ *  @param[in]  html_sjis   |[gtHI܂response(html/Shift-JIS)
+ *  @param[out] dst         i[
+ */
+void GetPortfolioPC(const std::string& html_sjis, std::vector<RcvStockValueData>& dst)
+{
+    bool b_portfolio = false;       // ȍ~PF܂htmlƔtrue
+    bool b_prev_pf_table = false;   // PFe[u̒Otrue
+    bool b_in_pf_table = false;     // PFe[uɓtrue
+    bool b_in_pf_row = false;       // PFe[u1̍sɓtrue
+    bool b_in_pf_obj = false;       // PFe[u1̍s1vfɓtrue
+    bool b_end = false;             // I^O
+    std::string current_obj;        // ݒڂĂvf(eLXg)
+    std::vector<ePortfolioColumn> pf_column;    // ڃXg
+    size_t pf_row_inx = 0;
+    size_t pf_obj_inx = 0;
+    RcvStockValueData valueunit;
+    std::string attr;
+
+    HtmlTokenizer tokenizer(html_sjis);
+    HtmlToken token;
+    while (tokenizer.Next(token)) {
+        switch (token.m_type)
+        {
+        case HtmlToken::TOKEN_START_TAG:
+            b_end = false;
+            if (!b_portfolio) {
+                if (token.IsTag("select") && token.GetAttribute("name", attr) && attr == "portforio_id") {
+                    b_portfolio = true;
+                }
+            } else if (!b_prev_pf_table) {
+                if (token.IsTag("input") && token.GetAttribute("value", attr) && attr == "XV") {
+                    b_prev_pf_table = true;
+                }
+            } else if (!b_in_pf_table) {
+                if (token.IsTag("table")) {
+                    b_in_pf_table = true;
+                }
+            } else if (!b_in_pf_row) {
+                if (token.IsTag("tr")) {
+                    b_in_pf_row = true;
+                    pf_obj_inx = 0;
+                }
+            } else if (!b_in_pf_obj) {
+                if (token.IsTag("td")) {
+                    b_in_pf_obj = true;
+                    current_obj.clear();
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_END_TAG:
+            b_end = true;
+            if (b_in_pf_row) {
+                if (token.IsTag("tr")) {
+                    // PFe[u1sI
+                    b_in_pf_row = false;
+                    if (pf_row_inx != 0) { // ږsȊO
+                        dst.push_back(valueunit);
+                    }
+                    pf_row_inx++;
+                } else if (token.IsTag("td") && b_in_pf_obj) {
+                    // PFe[u1objI
+                    b_in_pf_obj = false;
+                    if (pf_row_inx == 0) { // ږs
+                        pf_column.push_back(ToPortfolioColumn(current_obj));
+                    } else if (pf_obj_inx < pf_column.size()) {
+                        switch (pf_column[pf_obj_inx])
+                        {
+                        case PFCOL_CODE:
+                            valueunit.m_code = static_cast<uint32_t>(strtoul(current_obj.c_str(), nullptr, 10));
+                            break;
+                        case PFCOL_VALUE:
+                            valueunit.m_value = ToValue(current_obj);
+                            break;
+                        case PFCOL_VOLUME:
+                            valueunit.m_volume = (IsNumber(current_obj)) ?strtoll(current_obj.c_str(), nullptr, 10) :0;
+                            break;
+                        case PFCOL_OPEN:
+                            valueunit.m_open = ToValue(current_obj);
+                            break;
+                        case PFCOL_HIGH:
+                            valueunit.m_high = ToValue(current_obj);
+                            break;
+                        case PFCOL_LOW:
+                            valueunit.m_low = ToValue(current_obj);
+                            break;
+                        case PFCOL_CLOSE:
+                            valueunit.m_close = ToValue(current_obj);
+                            break;
+                        default:
+                            break;
+                        }
+                    }
+                    pf_obj_inx++;
+                }
+            } else if (b_in_pf_table) {
+                if (token.IsTag("table")) {
+                    return; // 
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_TEXT:
+            if (b_in_pf_obj && !b_end && current_obj.empty()) {
+                // ','͏Ă
+                current_obj.reserve(token.m_body_len);
+                for (size_t inx = 0; inx < token.m_body_len; inx++) {
+                    if (token.m_body[inx] != ',') {
+                        current_obj.push_back(token.m_body[inx]);
+                    }
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+/*!
+ *  @brief  regist_id؂o(SBI-mobile[obNAbv]TCgp)/
+ *  @param  html_u8 ͂response(html/UTF-8)
+ *  @param  type    
+ *  @return regist_id(Ȃ-1)
+ */
+int64_t GetStockOrderRegistID(const std::string& html_u8, eOrderType type)
+{
+    return GetStockOrderRegistIDCore(html_u8, type, u8"");
+}
+/*!
+ *  @brief  regist_id؂o(SBI-mobile[obNAbv]TCgp)/mF
+ *  @param  html_u8 mFresponse(html/UTF-8)
+ *  @param  type    
+ *  @return regist_id(Ȃ-1)
+ */
+int64_t GetStockOrderConfirmRegistID(const std::string& html_u8, eOrderType type)
+{
+    return GetStockOrderRegistIDCore(html_u8, type, u8"mF");
+}
+
+/*!
+ *  @brief  ʂ؂o(SBI-mobile[obNAbv]TCgp)
+ *  @param[in]  html_u8 sresponse(html/UTF-8)
+ *  @param[out] dst     i[
+ *  @retval true    tꂽ
+ *  @note   iKpythonStockOrderExParserƓ
+ */
+bool ResponseStockOrderExec(const std::string& html_u8, RcvResponseStockOrder& dst)
+{
+    enum eParseStep
+    {
+        STEP_TITLE_TAG,     //!< Ώtitle^O
+        STEP_TITLE,         //!< ^Cg`FbN
+        STEP_BR_TAG,        //!< Ώbr^O
+        STEP_RESULT,        //!< ۃtOZbgEʃZbg
+        STEP_ORDER_ID,      //!< Ώinput^OAԍ(Ǘp/\p)擾
+        STEP_TABLE,         //!< Ώtable
+        STEP_TD,            //!< td^O(table2I犮)
+        STEP_TD_DATA,       //!< td^OI܂ł̃f[^擾(łȂ̂܂)
+    };
+    eParseStep step = STEP_TITLE_TAG;
+    bool b_start = false;               // Jn^OȂtrue
+    bool b_result = false;              // 
+    eOrderType order_type = ORDER_NONE; // ^Cg瓾
+    int32_t table_count = 0;
+    HtmlToken tag_now;                  // ߂̊Jn^O
+    std::string str_work;
+    std::vector<std::string> td_data;
+    std::string attr;
+    std::string value;
+
+    dst.m_order_id = -1;
+    dst.m_user_order_id = -1;
+    dst.m_type = ORDER_NONE;
+    dst.m_investments = INVESTMENTS_NONE;
+    dst.m_code = 0;
+    dst.m_number = 0;
+    dst.m_value = 0.0;
+    dst.m_b_leverage = false;
+
+    HtmlTokenizer tokenizer(html_u8);
+    HtmlToken token;
+    while (tokenizer.Next(token)) {
+        switch (token.m_type)
+        {
+        case HtmlToken::TOKEN_START_TAG:
+            tag_now = token;
+            b_start = true;
+            if (step == STEP_TITLE_TAG) {
+                if (token.IsTag("div") && token.GetAttribute("class", attr) && attr == "titletext") {
+                    step = STEP_TITLE;
+                }
+            } else if (step == STEP_BR_TAG) {
+                if (token.IsTag("br")) {
+                    step = STEP_RESULT;
+                }
+            } else if (step == STEP_ORDER_ID) {
+                // /Ȃ΂Œԍ(Ǘp)𓾂Ă玟Xebv
+                if (token.IsTag("input") &&
+                    token.GetAttribute("name", attr) && token.GetAttribute("value", value) && attr == "orderNum") {
+                    step = STEP_TABLE;
+                    dst.m_order_id = static_cast<int32_t>(strtol(value.c_str(), nullptr, 10));
+                }
+            } else if (step == STEP_TABLE) {
+                if (token.IsTag("table") && table_count < 2) {
+                    step = STEP_TD;
+                    table_count++;
+                }
+            } else if (step == STEP_TD) {
+                if (token.IsTag("td")) {
+                    step = STEP_TD_DATA;
+                    str_work.clear();
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_TEXT:
+            {
+                const std::string data(token.GetText());
+                if (step == STEP_ORDER_ID && tag_now.IsTag("br") && IsDigitString(data)) {
+                    dst.m_user_order_id = static_cast<int32_t>(strtol(data.c_str(), nullptr, 10));
+                    // /Ȃ΂ŎXebv֐i߂(htmlɊǗpԍȂ̂)
+                    if (order_type == ORDER_CANCEL || order_type == ORDER_CORRECT) {
+                        step = STEP_TABLE;
+                    }
+                }
+                if (b_start) {
+                    if (step == STEP_TITLE) {
+                        if (tag_now.IsTag("div")) {
+                            if (Contains(data, u8"t")) {
+                                step = STEP_BR_TAG;
+                                if (Contains(data, u8"ԍϔ")) {
+                                    order_type = ORDER_REPSELL;
+                                } else if (Contains(data, u8"ԍϔ")) {
+                                    order_type = ORDER_REPBUY;
+                                } else if (Contains(data, u8"")) {
+                                    order_type = ORDER_BUY;
+                                } else if (Contains(data, u8"")) {
+                                    order_type = ORDER_SELL;
+                                }
+                            } else if (Contains(data, u8"") && Contains(data, u8"t")) {
+                                step = STEP_BR_TAG;
+                                order_type = ORDER_CORRECT;
+                            } else if (Contains(data, u8"") && Contains(data, u8"t")) {
+                                step = STEP_BR_TAG;
+                                order_type = ORDER_CANCEL;
+                            }
+                        }
+                    } else if (step == STEP_RESULT) {
+                        // Ђ炪/ɕ\Lꂪc
+                        if (tag_now.IsTag("br") &&
+                            Contains(data, u8"") &&
+                            (Contains(data, u8"t܂") || Contains(data, u8"tv܂"))) {
+                            step = STEP_ORDER_ID;
+                            b_result = true;
+                            dst.m_type = order_type;
+                        }
+                    } else if (step == STEP_TD_DATA) {
+                        if (str_work.empty()) {
+                            str_work = data;
+                        }
+                    }
+                }
+                b_start = false;
+            }
+            break;
+
+        case HtmlToken::TOKEN_END_TAG:
+            if (step == STEP_TD) {
+                if (token.IsTag("table")) {
+                    if (table_count < 2) {
+                        step = STEP_TABLE;
+                    } else {
+                        ConvertStockOrderExecTD(td_data, dst);
+                        return b_result; // 
+                    }
+                }
+            } else if (step == STEP_TD_DATA) {
+                if (token.IsTag("td")) {
+                    step = STEP_TD;
+                    td_data.push_back(str_work);
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+    return b_result;
+}
+
+/*!
+ *  @brief  ꗗ藚؂o(SBI-PC[C]TCgp)
+ *  @param[in]  html_sjis   ꗗresponse(html/Shift-JIS)
+ *  @param[in]  date_tm     M(̔NɎg)
+ *  @param[out] dst         i[(1t)
+ *  @retval true    ꗗ
+ *  @note   iKpythonTodayExecInfoParserƓ
+ *  @note   ł͓ǂݔ΂Ȃ(OƂ̔r͎󂯎葤̏Ԃōs)
+ */
+bool GetTodayExecInfo(const std::string& html_sjis,
+                      const garnet::sTime& date_tm,
+                      std::vector<StockExecInfoAtOrder>& dst)
+{
+    enum eParseStep
+    {
+        STEP_TITLE_TAG,     //!< Ώdiv^O
+        STEP_TITLE,         //!< div^OI`FbN => eLXgf[^`FbN(=擾ۃ`FbN)
+        STEP_TABLE,         //!< table(f[^{[10Ԗڂtable]玟)
+        STEP_TR,            //!< tr^O(tag=4tr,data=header<2tr>+data<N*1tr>BtableIo犮)
+        STEP_TD,            //!< td^O(tr^OIoSTEP_TR)
+        STEP_TD_DATA,       //!< td^OI`FbN => eLXgf[^擾STEP_TD
+    };
+    eParseStep step = STEP_TITLE_TAG;
+    bool b_result = false;          // parse
+    bool b_read_header = false;     // ږs(4tr)ǂݏItrue
+    int32_t table_count = 0;
+    int32_t tr_inx = 0;
+    int32_t td_inx = 0;
+    HtmlToken tag_now;              // ߂̊Jn^O
+    std::string current_obj;
+    std::vector<std::string> header_tag;    // wb_ږ
+    std::vector<std::string> data_tag;      // f[^ږ
+    std::vector<std::string> header_work;   // wb_(̂܂)
+    std::vector<std::string> data_work;     // f[^1s(̂܂)
+    std::vector<std::string> exec_work;     // f[^[,,P]*N(̂܂)
+    size_t inx_order_id = 0;
+    size_t inx_order_type = 0;
+    size_t inx_order_state = 0;
+    size_t inx_brand = 0;
+    size_t inx_exec_datetime = 0;
+    size_t inx_exec_number = 0;
+    size_t inx_exec_value = 0;
+    std::vector<std::string> brand_list;
+    std::string attr;
+
+    // 1o
+    const auto output_work = [&]()
+    {
+        if (!b_read_header) {
+            return;
+        }
+        if (!header_tag.empty() && header_tag.size() == header_work.size() && !exec_work.empty()) {
+            uint64_t hash = FNV_OFFSET_BASIS;
+            for (const auto& str: header_work) {
+                hash = HashString(hash, str);
+            }
+            for (const auto& str: exec_work) {
+                hash = HashString(hash, str);
+            }
+            //
+            StockExecInfoAtOrder exe_info;
+            exe_info.m_user_order_id
+                = static_cast<int32_t>(strtol(header_work[inx_order_id].c_str(), nullptr, 10));
+            exe_info.m_fingerprint = (hash != 0) ?hash :1; // 0́usvȂ̂Ŕ
+            ToOrderTypeFromSbiStr(header_work[inx_order_type], exe_info.m_type, exe_info.m_b_leverage);
+            exe_info.m_b_complete = Contains(header_work[inx_order_state], "");
+            brand_list.clear();
+            SplitBySpaceCRLF(header_work[inx_brand], brand_list);
+            if (brand_list.size() > 2) {
+                exe_info.m_code = static_cast<uint32_t>(strtoul(brand_list[1].c_str(), nullptr, 10));
+                if (Contains(brand_list[2], "")) {
+                    exe_info.m_investments = INVESTMENTS_TOKYO;
+                } else if (Contains(brand_list[2], "PTS")) {
+                    exe_info.m_investments = INVESTMENTS_PTS;
+                }
+            }
+            garnet::sTime exe_tm;
+            memset(reinterpret_cast<void*>(&exe_tm), 0, sizeof(exe_tm));
+            exe_info.m_exec.reserve(exec_work.size()/3);
+            for (size_t inx = 0; inx + 2 < exec_work.size(); inx += 3) {
+                std::string number(exec_work[inx+1]);
+                std::string value(exec_work[inx+2]);
+                EraseString(number, ",");
+                EraseString(value, ",");
+                // MM/DDHH:MM:SS̊Ԃɋ󔒂Ȃ(̂܂ܓǂ߂)
+                trade_datetime::ToTimeFromExecDateTime(exec_work[inx], exe_tm);
+                exe_tm.tm_year = date_tm.tm_year;
+                exe_info.m_exec.emplace_back(exe_tm,
+                                             static_cast<int32_t>(strtol(number.c_str(), nullptr, 10)),
+                                             strtod(value.c_str(), nullptr));
+            }
+            dst.emplace_back(std::move(exe_info));
+        }
+        header_work.clear();
+        exec_work.clear();
+    };
+
+    HtmlTokenizer tokenizer(html_sjis);
+    HtmlToken token;
+    while (tokenizer.Next(token)) {
+        switch (token.m_type)
+        {
+        case HtmlToken::TOKEN_START_TAG:
+            tag_now = token;
+            if (step == STEP_TITLE_TAG) {
+                if (token.IsTag("div") && token.GetAttribute("class", attr) && attr == "title-text") {
+                    step = STEP_TITLE;
+                }
+            } else if (step == STEP_TABLE) {
+                if (token.IsTag("table")) {
+                    table_count++;
+                    if (table_count == 10) {
+                        step = STEP_TR;
+                    }
+                }
+            } else if (step == STEP_TR) {
+                if (token.IsTag("tr")) {
+                    step = STEP_TD;
+                }
+            } else if (step == STEP_TD) {
+                if (token.IsTag("td")) {
+                    step = STEP_TD_DATA;
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_TEXT:
+            if (step == STEP_TITLE || step == STEP_TD_DATA) {
+                current_obj.append(token.m_body, token.m_body_len);
+            } else if (step == STEP_TABLE) {
+                if (tag_now.IsTag("div") || tag_now.IsTag("b") || tag_now.IsTag("font")) {
+                    if (Contains(token.GetText(), "ql̊͂܂")) {
+                        return b_result; // Ȃ
+                    }
+                }
+            }
+            break;
+
+        case HtmlToken::TOKEN_END_TAG:
+            if (step == STEP_TITLE) {
+                if (token.IsTag("div")) {
+                    if (current_obj != "ꗗ") {
+                        return false;
+                    }
+                    current_obj.clear();
+                    b_result = true;
+                    step = STEP_TABLE;
+                }
+            } else if (step == STEP_TR) {
+                if (token.IsTag("table")) {
+                    output_work();
+                    return b_result; // 
+                }
+            } else if (step == STEP_TD) {
+                if (token.IsTag("tr")) {
+                    td_inx = 0;
+                    step = STEP_TR;
+                    if (!b_read_header) {
+                        if (tr_inx == 3) {
+                            b_read_header = true;
+                            tr_inx = 0;
+                            if (!header_tag.empty()) {
+                                inx_order_id = SearchTdDataTag(header_tag, "ԍ");
+                                inx_order_type = SearchTdDataTag(header_tag, "a/萔");
+                                inx_order_state = SearchTdDataTag(header_tag, "");
+                                inx_brand = SearchTdDataTag(header_tag, "R[hs");
+                            }
+                            if (!data_tag.empty()) {
+                                inx_exec_datetime = SearchTdDataTag(data_tag, "");
+                                inx_exec_number = SearchTdDataTag(data_tag, "芔");
+                                inx_exec_value = SearchTdDataTag(data_tag, "P");
+                            }
+                        } else {
+                            tr_inx++;
+                        }
+                    } else if (tr_inx >= 2) {
+                        if (data_tag.empty() || data_tag.size() != data_work.size()) {
+                            return b_result; // error(^Oƃf[^HĂ)
+                        }
+                        // 'MM/DDHH:MM:SS'K{(Ȃs͓ǂݎ̂ĂȂpythonłƓ)
+                        if (data_work[inx_exec_datetime].size() == 13) {
+                            exec_work.push_back(data_work[inx_exec_datetime]);
+                            exec_work.push_back(data_work[inx_exec_number]);
+                            exec_work.push_back(data_work[inx_exec_value]);
+                            data_work.clear();
+                        }
+                        tr_inx++;
+                    } else {
+                        tr_inx++;
+                    }
+                }
+            } else if (step == STEP_TD_DATA) {
+                if (token.IsTag("td")) {
+                    if (!b_read_header) {
+                        if (tr_inx == 0 || tr_inx == 1) {
+                            header_tag.push_back(current_obj);
+                        } else if (tr_inx == 3) {
+                            data_tag.push_back(current_obj);
+                        }
+                    } else {
+                        if (td_inx == 0 && tr_inx >= 2) {
+                            // uf[^trv`FbN
+                            if (current_obj != "") {
+                                tr_inx = 0;
+                                output_work();
+                            }
+                        }
+                        if (tr_inx == 0 || tr_inx == 1) {
+                            header_work.push_back(current_obj);
+                        } else {
+                            data_work.push_back(current_obj);
+                        }
+                    }
+                    td_inx++;
+                    current_obj.clear();
+                    step = STEP_TD;
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+    return b_result;
+}
+
+} // namespace html_parser_sbi
+} // namespace trading
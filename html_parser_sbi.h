@@ -0,0 +1,77 @@
+/*!
+ *  @file   html_parser_sbi.h
+ *  @brief  SBI،TCghtml(native)
+ *  @date   2018/01/25
+ *  @note   html_parser_sbi.pŷpɂɌĂ΂̂C++Ŏ
+ *  @note   pythonłƓʂԂ
+ */
+#pragma once
+
+#include "trade_define.h"
+
+#include <string>
+#include <vector>
+
+namespace garnet { struct sTime; }
+
+namespace trading
+{
+
+struct RcvStockValueData;
+struct RcvResponseStockOrder;
+struct StockExecInfoAtOrder;
+
+namespace html_parser_sbi
+{
+
+/*!
+ *  @brief  |[gtHI؂o(SBI-PC[C]TCgp)/Ď
+ *  @param[in]  html_sjis   |[gtHI܂response(html/Shift-JIS)
+ *  @param[out] dst         i[
+ *  @note   html_parser_sbi.py:getPortfolioPC
+ *  @note   Shift-JIŜ܂܃oCg𑖍(ϊȂ)
+ */
+void GetPortfolioPC(const std::string& html_sjis, std::vector<RcvStockValueData>& dst);
+
+/*!
+ *  @brief  regist_id؂o(SBI-mobile[obNAbv]TCgp)/
+ *  @param  html_u8 (buyOrderEntry/sellOrderEntry)response(html/UTF-8)
+ *  @param  type    
+ *  @return regist_id(Ȃ-1)
+ *  @note   html_parser_sbi.py:getStockOrderRegistID
+ */
+int64_t GetStockOrderRegistID(const std::string& html_u8, eOrderType type);
+/*!
+ *  @brief  regist_id؂o(SBI-mobile[obNAbv]TCgp)/mF
+ *  @param  html_u8 mF(buyOrderEntryConfirm/sellOrderEntryConfirm)response(html/UTF-8)
+ *  @param  type    
+ *  @return regist_id(Ȃ-1)
+ *  @note   html_parser_sbi.py:getStockOrderConfirmRegistID
+ */
+int64_t GetStockOrderConfirmRegistID(const std::string& html_u8, eOrderType type);
+
+/*!
+ *  @brief  ʂ؂o(SBI-mobile[obNAbv]TCgp)
+ *  @param[in]  html_u8 s(buyOrderEx/sellOrderEx/orderCancelEx)response(html/UTF-8)
+ *  @param[out] dst     i[
+ *  @retval true    tꂽ
+ *  @note   html_parser_sbi.py:responseStockOrderExec
+ */
+bool ResponseStockOrderExec(const std::string& html_u8, RcvResponseStockOrder& dst);
+
+/*!
+ *  @brief  ꗗ藚؂o(SBI-PC[C]TCgp)
+ *  @param[in]  html_sjis   ꗗresponse(html/Shift-JIS)
+ *  @param[in]  date_tm     M(̔NɎg)
+ *  @param[out] dst         i[(1t)
+ *  @retval true    ꗗ
+ *  @note   html_parser_sbi.py:getTodayExecInfo
+ *  @note   1̍s(̂܂)wm_fingerprintɓ
+ *  @note   w̔r(ω̂Ȃ̓ǂݔ΂)͎󂯎葤(StockHoldingsKeeper::GetExecInfoDiff)ōs
+ */
+bool GetTodayExecInfo(const std::string& html_sjis,
+                      const garnet::sTime& date_tm,
+                      std::vector<StockExecInfoAtOrder>& dst);
+
+} // namespace html_parser_sbi
+} // namespace trading
@@ -0,0 +1,734 @@
+/*!
+ *  @file   http_client_pool.cpp
+ *  @brief  http_clientێ(ڑg)
+ *  @date   2018/01/24
+ */
+#include "http_client_pool.h"
+
+#include "thread_affinity.h"
+
+#include <algorithm>
+#include <chrono>
+#include <codecvt>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace trading
+{
+
+class HttpClientPool::PIMPL
+{
+private:
+    typedef std::chrono::steady_clock clock;
+    typedef std::function<void()> TimerFunc;
+
+    enum
+    {
+        LATENCY_SAMPLE = 64,        //!< ԕێ(zXg)
+        LATENCY_SAMPLE_MIN = 16,    //!< \vɕKvȉԐ
+    };
+
+    /*!
+     *  @brief  v[
+     */
+    struct LaneState
+    {
+        //! M҂<, M>
+        std::deque<std::pair<clock::time_point, TimerFunc>> m_queue;
+        int32_t m_active;           //!< M̐
+        LaneStatistics m_stat;      //!< v
+
+        LaneState()
+        : m_queue()
+        , m_active(0)
+        , m_stat()
+        {
+        }
+    };
+
+    /*!
+     *  @brief  ێhttp_client(1zXg)
+     */
+    struct PooledClient
+    {
+        std::shared_ptr<web::http::client::http_client> m_pClient;  //!< http_client
+        Statistics m_stat;                                          //!< v
+        std::vector<int64_t> m_latency;                             //!< ߂̉[~b]()
+        size_t m_latency_pos;                                       //!< ɏވʒu
+
+        PooledClient()
+        : m_pClient()
+        , m_stat()
+        , m_latency()
+        , m_latency_pos(0)
+        {
+        }
+    };
+
+    /*!
+     *  @brief  \vtv̏
+     */
+    struct HedgedRequest
+    {
+        std::mutex m_mtx;                                           //!< rq
+        pplx::task_completion_event<web::http::http_response> m_tce;//!< ʒm
+        pplx::cancellation_token_source m_cts[2];                   //!< ({v/\v)
+        uint64_t m_hedge_timer;                                     //!< \v^C}ID
+        uint64_t m_deadline_timer;                                  //!< ^C}ID
+        int32_t m_pending;                                          //!< ҂
+        bool m_b_done;                                              //!< ʊmς
+
+        HedgedRequest()
+        : m_mtx()
+        , m_tce()
+        , m_cts()
+        , m_hedge_timer(0)
+        , m_deadline_timer(0)
+        , m_pending(0)
+        , m_b_done(false)
+        {
+        }
+    };
+
+    const int64_t m_timeout_ms;         //!< v[~b]
+    const int32_t m_hedge_percentile;   //!< \voԂ̕S
+    const int64_t m_hedge_min_ms;       //!< \vo܂ł̍ŒZ҂[~b]
+    mutable std::mutex m_mtx;           //!< rq
+    //! ێhttp_client<zXg, ێhttp_client>
+    std::unordered_map<std::wstring, PooledClient> m_client;
+
+    const int32_t m_request_per_second;         //!< Ŝ̗v[/b](0Ȃ疳)
+    mutable std::mutex m_lane_mtx;              //!< [prq
+    LaneState m_lane[NUM_LANE];                 //!< [
+    float64 m_budget;                           //!< v\Z(1b܂Œ܂)
+    clock::time_point m_budget_time;            //!< \ZŌɕ[
+    bool m_b_dispatch_timer;                    //!< \Z[҂^C}o^ς
+
+    std::mutex m_timer_mtx;                                     //!< ^C}prq
+    std::condition_variable m_timer_cond;                       //!< ^C}o^/Iʒm
+    std::multimap<clock::time_point, std::pair<uint64_t, TimerFunc>> m_timer; //!< ^C}<Ύ, <ID, >>
+    uint64_t m_timer_id;                                        //!< Ōɔs^C}ID
+    bool m_b_terminate;                                         //!< Iv
+    std::thread m_timer_thread;                                 //!< ^C}Xbh
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  oߎ[~b]
+     */
+    static int64_t ElapsedMilliSeconds(const clock::time_point& begin)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - begin).count();
+    }
+
+    /*!
+     *  @brief  ^C}Xbh
+     */
+    void RunTimer()
+    {
+        thread_affinity::ApplyCurrentThread(thread_affinity::ROLE_NETWORK);
+        std::unique_lock<std::mutex> lock(m_timer_mtx);
+        while (!m_b_terminate) {
+            if (m_timer.empty()) {
+                m_timer_cond.wait(lock);
+                continue;
+            }
+            const auto it = m_timer.begin();
+            if (clock::now() < it->first) {
+                m_timer_cond.wait_until(lock, it->first);
+                continue;
+            }
+            const TimerFunc func(std::move(it->second.second));
+            m_timer.erase(it);
+            lock.unlock();
+            func();
+            lock.lock();
+        }
+    }
+    /*!
+     *  @brief  ^C}o^
+     *  @param  delay_ms    ΂܂ł̎[~b]
+     *  @param  func        Ύ̏(^C}XbhŎs)
+     *  @return ^C}ID
+     */
+    uint64_t SetTimer(int64_t delay_ms, const TimerFunc& func)
+    {
+        const clock::time_point fire_time = clock::now() + std::chrono::milliseconds(delay_ms);
+        uint64_t id = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_timer_mtx);
+            id = ++m_timer_id;
+            m_timer.emplace(fire_time, std::make_pair(id, func));
+        }
+        m_timer_cond.notify_one();
+        return id;
+    }
+    /*!
+     *  @brief  ^C}
+     *  @param  id  ^C}ID
+     *  @note   ΍ς݂Ȃ牽Ȃ
+     */
+    void KillTimer(uint64_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_timer_mtx);
+        for (auto it = m_timer.begin(); it != m_timer.end(); ++it) {
+            if (it->second.first == id) {
+                m_timer.erase(it);
+                return;
+            }
+        }
+    }
+
+    /*!
+     *  @brief  [ʓM
+     */
+    static int32_t GetLaneConcurrency(eLane lane)
+    {
+        // v͗\v̕󂯂Ă
+        static const int32_t LANE_CONCURRENCY[NUM_LANE] = { 2, 2, 4, 2, 2, 1 };
+        return LANE_CONCURRENCY[lane];
+    }
+    /*!
+     *  @brief  v\Z[
+     *  @note   m_lane_mtxbNČĂԂ
+     */
+    void RefillBudget()
+    {
+        const clock::time_point now = clock::now();
+        const float64 elapsed_sec
+            = std::chrono::duration_cast<std::chrono::duration<float64>>(now - m_budget_time).count();
+        m_budget = std::min(m_budget + elapsed_sec*m_request_per_second,
+                            static_cast<float64>(m_request_per_second));
+        m_budget_time = now;
+    }
+    /*!
+     *  @brief  M҂U蕪
+     *  @note   Dx̍[AMƗv\Z͈̔͂őM
+     *  @note   /E͗\ZsĂĂ҂Ȃ(\Z͎؂)
+     */
+    void Dispatch()
+    {
+        std::vector<TimerFunc> start;
+        int64_t wait_ms = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_lane_mtx);
+            const bool b_budget = (m_request_per_second > 0);
+            if (b_budget) {
+                RefillBudget();
+            }
+            bool b_wait_budget = false;
+            for (int32_t inx = 0; inx < NUM_LANE; inx++) {
+                const eLane lane = static_cast<eLane>(inx);
+                LaneState& ls(m_lane[inx]);
+                while (!ls.m_queue.empty() && ls.m_active < GetLaneConcurrency(lane)) {
+                    if (b_budget && lane >= LANE_GENERAL && m_budget < 1.0) {
+                        b_wait_budget = true;
+                        break;
+                    }
+                    const int64_t wait = ElapsedMilliSeconds(ls.m_queue.front().first);
+                    ls.m_stat.m_total_wait_ms += wait;
+                    ls.m_stat.m_max_wait_ms = std::max(ls.m_stat.m_max_wait_ms, wait);
+                    start.push_back(std::move(ls.m_queue.front().second));
+                    ls.m_queue.pop_front();
+                    ls.m_active++;
+                    if (b_budget) {
+                        m_budget -= 1.0;
+                    }
+                }
+            }
+            if (b_wait_budget && !m_b_dispatch_timer) {
+                // 1񕪒܂邱ɐU蕪
+                wait_ms = static_cast<int64_t>((1.0 - m_budget)*1000.0/m_request_per_second) + 1;
+                m_b_dispatch_timer = true;
+            }
+        }
+        if (wait_ms > 0) {
+            SetTimer(wait_ms, [this]()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_lane_mtx);
+                    m_b_dispatch_timer = false;
+                }
+                Dispatch();
+            });
+        }
+        for (const auto& func: start) {
+            func();
+        }
+    }
+    /*!
+     *  @brief  MI
+     *  @param  lane    v[
+     */
+    void EndLane(eLane lane)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_lane_mtx);
+            m_lane[lane].m_active--;
+        }
+        Dispatch();
+    }
+    /*!
+     *  @brief  [ɐςőM
+     *  @param  lane        v[
+     *  @param  p_client    http_client
+     *  @param  request     v
+     *  @param  token       g[N
+     *  @return ^XN
+     *  @note   (؂)ꂽ̂͑MƂős
+     */
+    pplx::task<web::http::http_response> Send(eLane lane,
+                                              const std::shared_ptr<web::http::client::http_client>& p_client,
+                                              const web::http::http_request& request,
+                                              const pplx::cancellation_token& token)
+    {
+        pplx::task_completion_event<web::http::http_response> tce;
+        const TimerFunc start = [this, lane, p_client, request, token, tce]()
+        {
+            p_client->request(request, token).then([this, lane, tce](pplx::task<web::http::http_response> prev)
+            {
+                // cpprest̃Xbhv[͎OŐȂ̂ōŏɎMƂŔzu
+                thread_affinity::ApplyCurrentThreadOnce(thread_affinity::ROLE_NETWORK);
+                EndLane(lane);
+                try {
+                    tce.set(prev.get());
+                } catch (...) {
+                    tce.set_exception(std::current_exception());
+                }
+            });
+        };
+        {
+            std::lock_guard<std::mutex> lock(m_lane_mtx);
+            LaneState& ls(m_lane[lane]);
+            ls.m_stat.m_request++;
+            if (!ls.m_queue.empty() || ls.m_active >= GetLaneConcurrency(lane)) {
+                ls.m_stat.m_queued++;
+            }
+            ls.m_queue.emplace_back(clock::now(), start);
+        }
+        Dispatch();
+        return pplx::create_task(tce);
+    }
+
+    /*!
+     *  @brief  vZ
+     *  @param  host    zXg
+     *  @param  counter Z铝vl
+     */
+    void AddCount(const std::wstring& host, int64_t Statistics::*counter)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        const auto it = m_client.find(host);
+        if (it != m_client.end()) {
+            (it->second.m_stat.*counter)++;
+        }
+    }
+    /*!
+     *  @brief  ԋL^
+     *  @param  host        zXg
+     *  @param  latency_ms  [~b]
+     */
+    void AddLatency(const std::wstring& host, int64_t latency_ms)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        const auto it = m_client.find(host);
+        if (it != m_client.end()) {
+            PooledClient& pooled(it->second);
+            if (pooled.m_latency.size() < LATENCY_SAMPLE) {
+                pooled.m_latency.push_back(latency_ms);
+            } else {
+                pooled.m_latency[pooled.m_latency_pos] = latency_ms;
+            }
+            pooled.m_latency_pos = (pooled.m_latency_pos + 1) % LATENCY_SAMPLE;
+        }
+    }
+    /*!
+     *  @brief  \vo܂ł̑҂Ԏ擾
+     *  @param  host    zXg
+     *  @return ҂[~b](0Ȃ\vȂ)
+     */
+    int64_t GetHedgeDelay(const std::wstring& host) const
+    {
+        if (m_hedge_percentile <= 0) {
+            return 0;
+        }
+        std::vector<int64_t> latency;
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            const auto it = m_client.find(host);
+            if (it == m_client.end() || it->second.m_latency.size() < LATENCY_SAMPLE_MIN) {
+                return 0; // fޗs
+            }
+            latency = it->second.m_latency;
+        }
+        const size_t inx = (latency.size() - 1)*std::min(m_hedge_percentile, 100)/100;
+        std::nth_element(latency.begin(), latency.begin() + inx, latency.end());
+        return std::max(latency[inx], m_hedge_min_ms);
+    }
+
+    /*!
+     *  @brief  v
+     *  @param[in]  url         vURL(t)
+     *  @param[io]  request     v
+     *  @param[out] host        zXg
+     *  @return http_client
+     */
+    std::shared_ptr<web::http::client::http_client> PrepareRequest(const std::wstring& url,
+                                                                   web::http::http_request& request,
+                                                                   std::wstring& host)
+    {
+        const web::uri uri(url);
+        host = std::move(uri.authority().to_string());
+        request.set_request_uri(uri.resource());
+        //
+        std::lock_guard<std::mutex> lock(m_mtx);
+        PooledClient& pooled(m_client[host]);
+        if (!pooled.m_pClient) {
+            web::http::client::http_client_config config;
+            config.set_timeout(std::chrono::milliseconds(m_timeout_ms));
+            pooled.m_pClient.reset(new web::http::client::http_client(host, config));
+            pooled.m_stat.m_host = host;
+            pooled.m_stat.m_connect++;
+        }
+        pooled.m_stat.m_request++;
+        return pooled.m_pClient;
+    }
+
+    /*!
+     *  @brief  \vtv1{𑗂
+     *  @param  lane        v[
+     *  @param  host        zXg
+     *  @param  p_client    http_client
+     *  @param  request     v
+     *  @param  p_hedged    \vtv̏
+     *  @param  leg         0:{v/1:\v
+     *  @param  begin       {vo
+     */
+    void SendHedgedLeg(eLane lane,
+                       const std::wstring& host,
+                       const std::shared_ptr<web::http::client::http_client>& p_client,
+                       const web::http::http_request& request,
+                       const std::shared_ptr<HedgedRequest>& p_hedged,
+                       int32_t leg,
+                       const clock::time_point& begin)
+    {
+        Send(lane, p_client, request, p_hedged->m_cts[leg].get_token()).then([this, host, p_hedged, leg, begin]
+            (pplx::task<web::http::http_response> prev)
+        {
+            try {
+                const web::http::http_response response(prev.get());
+                {
+                    std::lock_guard<std::mutex> lock(p_hedged->m_mtx);
+                    if (p_hedged->m_b_done) {
+                        return; // 
+                    }
+                    p_hedged->m_b_done = true;
+                }
+                KillTimer(p_hedged->m_hedge_timer);
+                KillTimer(p_hedged->m_deadline_timer);
+                p_hedged->m_cts[1-leg].cancel(); // ͎
+                AddLatency(host, ElapsedMilliSeconds(begin));
+                if (leg != 0) {
+                    AddCount(host, &Statistics::m_hedge_win);
+                }
+                p_hedged->m_tce.set(response);
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(p_hedged->m_mtx);
+                    p_hedged->m_pending--;
+                    if (p_hedged->m_b_done || p_hedged->m_pending > 0) {
+                        return; // ʊmς or 1{̉҂
+                    }
+                    p_hedged->m_b_done = true;
+                }
+                KillTimer(p_hedged->m_hedge_timer);
+                KillTimer(p_hedged->m_deadline_timer);
+                AddCount(host, &Statistics::m_fail);
+                p_hedged->m_tce.set_exception(std::current_exception());
+            }
+        });
+    }
+
+public:
+    /*!
+     *  @param  timeout_ms          v[~b]
+     *  @param  hedge_percentile    \voԂ̕S
+     *  @param  hedge_min_ms        \vo܂ł̍ŒZ҂[~b]
+     *  @param  request_per_second  Ŝ̗v[/b]
+     */
+    PIMPL(int64_t timeout_ms, int32_t hedge_percentile, int64_t hedge_min_ms, int32_t request_per_second)
+    : m_timeout_ms(timeout_ms)
+    , m_hedge_percentile(hedge_percentile)
+    , m_hedge_min_ms(hedge_min_ms)
+    , m_mtx()
+    , m_client()
+    , m_request_per_second(std::max(request_per_second, 0))
+    , m_lane_mtx()
+    , m_lane()
+    , m_budget(static_cast<float64>(m_request_per_second))
+    , m_budget_time(clock::now())
+    , m_b_dispatch_timer(false)
+    , m_timer_mtx()
+    , m_timer_cond()
+    , m_timer()
+    , m_timer_id(0)
+    , m_b_terminate(false)
+    , m_timer_thread()
+    {
+        m_timer_thread = std::thread([this]() { RunTimer(); });
+    }
+    ~PIMPL()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_timer_mtx);
+            m_b_terminate = true;
+        }
+        m_timer_cond.notify_all();
+        m_timer_thread.join();
+    }
+
+    /*!
+     *  @brief  vM
+     *  @param  url     vURL(t)
+     *  @param  request v
+     *  @param  lane    v[
+     */
+    pplx::task<web::http::http_response> Request(const std::wstring& url,
+                                                  web::http::http_request& request,
+                                                  eLane lane)
+    {
+        std::wstring host;
+        std::shared_ptr<web::http::client::http_client> p_client(PrepareRequest(url, request, host));
+        //
+        const clock::time_point begin = clock::now();
+        pplx::cancellation_token_source cts;
+        const uint64_t deadline_timer = SetTimer(m_timeout_ms, [this, host, cts]()
+        {
+            AddCount(host, &Statistics::m_timeout);
+            cts.cancel(); // ؂(ďothenɂ͗O`)
+        });
+        pplx::task<web::http::http_response> task(Send(lane, p_client, request, cts.get_token()));
+        task.then([this, host, begin, deadline_timer](pplx::task<web::http::http_response> prev)
+        {
+            KillTimer(deadline_timer);
+            try {
+                prev.wait();
+                AddLatency(host, ElapsedMilliSeconds(begin));
+            } catch (...) {
+                AddCount(host, &Statistics::m_fail); // ʐMs(O͌ďothenɂ`)
+            }
+        });
+        return task;
+    }
+
+    /*!
+     *  @brief  vM(\vt)
+     *  @param  url     vURL(t)
+     *  @param  request v
+     *  @param  lane    v[
+     */
+    pplx::task<web::http::http_response> RequestHedged(const std::wstring& url,
+                                                        web::http::http_request& request,
+                                                        eLane lane)
+    {
+        const web::uri uri(url);
+        const int64_t hedge_ms = GetHedgeDelay(uri.authority().to_string());
+        if (hedge_ms <= 0) {
+            return Request(url, request, lane);
+        }
+        std::wstring host;
+        std::shared_ptr<web::http::client::http_client> p_client(PrepareRequest(url, request, host));
+        // \v͓eō蒼(http_request1񂵂Ȃ)
+        web::http::http_request hedge_request(request.method());
+        hedge_request.headers() = request.headers();
+        hedge_request.set_request_uri(request.request_uri());
+        //
+        const clock::time_point begin = clock::now();
+        std::shared_ptr<HedgedRequest> p_hedged(std::make_shared<HedgedRequest>());
+        p_hedged->m_pending = 1;
+        p_hedged->m_hedge_timer = SetTimer(hedge_ms, [this, lane, host, p_client, hedge_request, p_hedged, begin]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(p_hedged->m_mtx);
+                if (p_hedged->m_b_done) {
+                    return;
+                }
+                p_hedged->m_pending++;
+            }
+            AddCount(host, &Statistics::m_hedge);
+            SendHedgedLeg(lane, host, p_client, hedge_request, p_hedged, 1, begin);
+        });
+        p_hedged->m_deadline_timer = SetTimer(m_timeout_ms, [this, host, p_hedged]()
+        {
+            AddCount(host, &Statistics::m_timeout);
+            p_hedged->m_cts[0].cancel();
+            p_hedged->m_cts[1].cancel();
+        });
+        SendHedgedLeg(lane, host, p_client, request, p_hedged, 0, begin);
+        return pplx::create_task(p_hedged->m_tce);
+    }
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(std::vector<Statistics>& dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        dst.reserve(dst.size() + m_client.size());
+        for (const auto& pooled: m_client) {
+            dst.push_back(pooled.second.m_stat);
+        }
+    }
+
+    /*!
+     *  @brief  vo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLog(const std::string& filename) const
+    {
+        std::vector<Statistics> stat;
+        GetStatistics(stat);
+        //
+        std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> cv;
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "host,request,connect,reuse_ratio,fail,timeout,hedge,hedge_win" << std::endl;
+        for (const auto& st: stat) {
+            const float64 reuse_ratio
+                = (st.m_request > 0) ?static_cast<float64>(st.m_request - st.m_connect)/static_cast<float64>(st.m_request)
+                                     :0.0;
+            outputfile << cv.to_bytes(st.m_host) << ",";
+            outputfile << st.m_request << "," << st.m_connect << ",";
+            outputfile << reuse_ratio << "," << st.m_fail << ",";
+            outputfile << st.m_timeout << "," << st.m_hedge << "," << st.m_hedge_win << std::endl;
+        }
+        outputfile.close();
+    }
+
+    /*!
+     *  @brief  [ʓv擾
+     *  @param[out] dst i[([)
+     */
+    void GetLaneStatistics(std::vector<LaneStatistics>& dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_lane_mtx);
+        dst.reserve(dst.size() + NUM_LANE);
+        for (const auto& ls: m_lane) {
+            dst.push_back(ls.m_stat);
+        }
+    }
+
+    /*!
+     *  @brief  [ʓvo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLaneLog(const std::string& filename) const
+    {
+        static const char* const LANE_NAME[NUM_LANE] = {
+            "order", "control", "general", "execinfo", "valuedata", "keepalive",
+        };
+        std::vector<LaneStatistics> stat;
+        GetLaneStatistics(stat);
+        //
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "lane,request,queued,ave_wait_ms,max_wait_ms" << std::endl;
+        for (size_t inx = 0; inx < stat.size(); inx++) {
+            const LaneStatistics& st(stat[inx]);
+            const int64_t ave_wait_ms = (st.m_request > 0) ?st.m_total_wait_ms/st.m_request :0;
+            outputfile << LANE_NAME[inx] << "," << st.m_request << "," << st.m_queued << ",";
+            outputfile << ave_wait_ms << "," << st.m_max_wait_ms << std::endl;
+        }
+        outputfile.close();
+    }
+};
+
+/*!
+ *  @param  timeout_ms          v[~b]
+ *  @param  hedge_percentile    \voԂ̕S(0Ȃ\vȂ)
+ *  @param  hedge_min_ms        \vo܂ł̍ŒZ҂[~b]
+ *  @param  request_per_second  Ŝ̗v[/b](0Ȃ疳)
+ */
+HttpClientPool::HttpClientPool(int64_t timeout_ms,
+                               int32_t hedge_percentile,
+                               int64_t hedge_min_ms,
+                               int32_t request_per_second)
+: m_pImpl(new PIMPL(timeout_ms, hedge_percentile, hedge_min_ms, request_per_second))
+{
+}
+/*!
+ */
+HttpClientPool::~HttpClientPool()
+{
+}
+
+/*!
+ *  @brief  vM
+ *  @param  url     vURL(t)
+ *  @param  request v request_uriurl̃pXȍ~ŏ㏑
+ *  @param  lane    v[
+ *  @return ^XN
+ */
+pplx::task<web::http::http_response> HttpClientPool::Request(const std::wstring& url,
+                                                             web::http::http_request& request,
+                                                             eLane lane)
+{
+    return m_pImpl->Request(url, request, lane);
+}
+/*!
+ *  @brief  vM(\vt)
+ *  @param  url     vURL(t)
+ *  @param  request v request_uriurl̃pXȍ~ŏ㏑
+ *  @param  lane    v[
+ *  @return ^XN(ɉ)
+ */
+pplx::task<web::http::http_response> HttpClientPool::RequestHedged(const std::wstring& url,
+                                                                   web::http::http_request& request,
+                                                                   eLane lane)
+{
+    return m_pImpl->RequestHedged(url, request, lane);
+}
+
+/*!
+ *  @brief  v擾
+ *  @param[out] dst i[
+ */
+void HttpClientPool::GetStatistics(std::vector<Statistics>& dst) const
+{
+    m_pImpl->GetStatistics(dst);
+}
+
+/*!
+ *  @brief  vo
+ *  @param  filename    o̓t@C
+ */
+void HttpClientPool::OutputLog(const std::string& filename) const
+{
+    m_pImpl->OutputLog(filename);
+}
+
+/*!
+ *  @brief  [ʓv擾
+ *  @param[out] dst i[([)
+ */
+void HttpClientPool::GetLaneStatistics(std::vector<LaneStatistics>& dst) const
+{
+    m_pImpl->GetLaneStatistics(dst);
+}
+
+/*!
+ *  @brief  [ʓvo
+ *  @param  filename    o̓t@C
+ */
+void HttpClientPool::OutputLaneLog(const std::string& filename) const
+{
+    m_pImpl->OutputLaneLog(filename);
+}
+
+} // namespace trading
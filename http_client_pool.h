@@ -0,0 +1,158 @@
+/*!
+ *  @file   http_client_pool.h
+ *  @brief  http_clientێ(ڑg)
+ *  @date   2018/01/24
+ *  @note   zXgƂhttp_client1ێAkeep-aliveڑg
+ *  @note   vɂ݂͊A(҂Ŏ~܂Ȃ悤)
+ *  @note   v̓[(Dx)ʂɐςŁADx̍̂瑗
+ */
+#pragma once
+
+#include "cpprest/http_client.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace trading
+{
+
+/*!
+ *  @brief  http_clientێNX
+ *  @note   http_clientvƂɐƐڑ(TLSnhVFCN܂)蒼ƂɂȂ̂
+ *  @note   zXg(scheme://host:port)PʂŕێĎg
+ */
+class HttpClientPool
+{
+public:
+    /*!
+     *  @brief  v[(Dx)
+     */
+    enum eLane
+    {
+        LANE_ORDER = 0,     //!< ()
+        LANE_CONTROL,       //!< /
+        LANE_GENERAL,       //!< ̑(OC/Ďo^/ǂ݂Ȃ)
+        LANE_EXECINFO,      //!< 
+        LANE_VALUEDATA,     //!< Ďif[^
+        LANE_KEEPALIVE,     //!< ZbVێ
+
+        NUM_LANE
+    };
+
+    /*!
+     *  @brief  v(1zXg)
+     */
+    struct Statistics
+    {
+        std::wstring m_host;    //!< zXg(scheme://host:port)
+        int64_t m_request;      //!< v
+        int64_t m_connect;      //!< http_client(=VKڑ̉)
+        int64_t m_fail;         //!< s(𓾂Ȃ)
+        int64_t m_timeout;      //!< ؂Ŏ
+        int64_t m_hedge;        //!< \vo
+        int64_t m_hedge_win;    //!< \v̕ɉ
+
+        Statistics()
+        : m_host()
+        , m_request(0)
+        , m_connect(0)
+        , m_fail(0)
+        , m_timeout(0)
+        , m_hedge(0)
+        , m_hedge_win(0)
+        {
+        }
+    };
+
+    /*!
+     *  @brief  v(1[)
+     */
+    struct LaneStatistics
+    {
+        int64_t m_request;      //!< v
+        int64_t m_queued;       //!< M҂ɂȂ
+        int64_t m_total_wait_ms;//!< M҂ԍv[~b]
+        int64_t m_max_wait_ms;  //!< ő呗M҂[~b]
+
+        LaneStatistics()
+        : m_request(0)
+        , m_queued(0)
+        , m_total_wait_ms(0)
+        , m_max_wait_ms(0)
+        {
+        }
+    };
+
+    /*!
+     *  @param  timeout_ms          v[~b]
+     *  @param  hedge_percentile    \voԂ̕S(0Ȃ\vȂ)
+     *  @param  hedge_min_ms        \vo܂ł̍ŒZ҂[~b]
+     *  @param  request_per_second  Ŝ̗v[/b](0Ȃ疳)
+     *  @note   /E͗vő҂Ȃ(̕㑱̑[҂)
+     */
+    HttpClientPool(int64_t timeout_ms,
+                   int32_t hedge_percentile,
+                   int64_t hedge_min_ms,
+                   int32_t request_per_second);
+    ~HttpClientPool();
+
+    /*!
+     *  @brief  vM
+     *  @param  url     vURL(t)
+     *  @param  request v request_uriurl̃pXȍ~ŏ㏑
+     *  @param  lane    v[
+     *  @return ^XN
+     */
+    pplx::task<web::http::http_response> Request(const std::wstring& url,
+                                                  web::http::http_request& request,
+                                                  eLane lane);
+    /*!
+     *  @brief  vM(\vt)
+     *  @param  url     vURL(t)
+     *  @param  request v request_uriurl̃pXȍ~ŏ㏑
+     *  @param  lane    v[
+     *  @return ^XN(ɉ)
+     *  @note   zXg̉(S)𒴂ĂȂΓv1o
+     *  @note   xĂǂv({̂ȂGET)ɂg
+     */
+    pplx::task<web::http::http_response> RequestHedged(const std::wstring& url,
+                                                        web::http::http_request& request,
+                                                        eLane lane);
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(std::vector<Statistics>& dst) const;
+
+    /*!
+     *  @brief  vo
+     *  @param  filename    o̓t@C
+     *  @note   csv`
+     */
+    void OutputLog(const std::string& filename) const;
+
+    /*!
+     *  @brief  [ʓv擾
+     *  @param[out] dst i[([)
+     */
+    void GetLaneStatistics(std::vector<LaneStatistics>& dst) const;
+
+    /*!
+     *  @brief  [ʓvo
+     *  @param  filename    o̓t@C
+     *  @note   csv`
+     */
+    void OutputLaneLog(const std::string& filename) const;
+
+private:
+    HttpClientPool(const HttpClientPool&);
+    HttpClientPool(HttpClientPool&&);
+    HttpClientPool& operator= (const HttpClientPool&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
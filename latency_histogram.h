@@ -0,0 +1,152 @@
+/*!
+ *  @file   latency_histogram.h
+ *  @brief  xqXgO
+ *  @date   2018/01/30
+ *  @note   oHxv؂o(ԌvƋp)
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace trading
+{
+
+/*!
+ *  @brief  xqXgO
+ *  @note   HDR Histogram̑ΐ`oPbg
+ *  @note   2̙pƂ16(L͏5bit)
+ */
+class LatencyHistogram
+{
+private:
+    enum
+    {
+        SUB_BUCKET_BITS = 4,                        //!< bit
+        SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS,    //!< 
+        MAX_MSB = 40,                               //!< ŏbit(12.7[}CNb])
+        NUM_BUCKET = (MAX_MSB - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT,
+    };
+
+    std::array<int64_t, NUM_BUCKET> m_bucket;   //!< oPbg
+    int64_t m_count;    //!< L^
+    int64_t m_sum;      //!< v
+    int64_t m_min;      //!< ŏ
+    int64_t m_max;      //!< ő
+
+    /*!
+     *  @brief  loPbgԍ𓾂
+     *  @param  value   l(0ȏ)
+     */
+    static int32_t ToIndex(int64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<int32_t>(value);
+        }
+        int32_t msb = 0;
+        for (int64_t v = value; v > 1; v >>= 1) {
+            msb++;
+        }
+        if (msb > MAX_MSB) {
+            return NUM_BUCKET - 1;
+        }
+        const int32_t shift = msb - SUB_BUCKET_BITS;
+        return shift*SUB_BUCKET_COUNT + static_cast<int32_t>(value >> shift);
+    }
+    /*!
+     *  @brief  oPbgԍl𓾂
+     *  @param  index   oPbgԍ
+     */
+    static int64_t ToUpperValue(int32_t index)
+    {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        const int32_t shift = index/SUB_BUCKET_COUNT - 1;
+        const int64_t top = index - shift*SUB_BUCKET_COUNT;
+        return ((top + 1) << shift) - 1;
+    }
+
+public:
+    LatencyHistogram()
+    : m_bucket()
+    , m_count(0)
+    , m_sum(0)
+    , m_min(0)
+    , m_max(0)
+    {
+        m_bucket.fill(0);
+    }
+
+    /*!
+     *  @brief  L^
+     *  @param  value   l
+     */
+    void Record(int64_t value)
+    {
+        if (value < 0) {
+            value = 0; // t](NȂ͂)
+        }
+        m_bucket[ToIndex(value)]++;
+        if (m_count == 0 || value < m_min) {
+            m_min = value;
+        }
+        if (value > m_max) {
+            m_max = value;
+        }
+        m_sum += value;
+        m_count++;
+    }
+    /*!
+     *  @brief  Z
+     *  @param  src qXgO
+     */
+    void Add(const LatencyHistogram& src)
+    {
+        if (src.m_count == 0) {
+            return;
+        }
+        for (size_t inx = 0; inx < m_bucket.size(); inx++) {
+            m_bucket[inx] += src.m_bucket[inx];
+        }
+        if (m_count == 0 || src.m_min < m_min) {
+            m_min = src.m_min;
+        }
+        if (src.m_max > m_max) {
+            m_max = src.m_max;
+        }
+        m_sum += src.m_sum;
+        m_count += src.m_count;
+    }
+
+    /*!
+     *  @brief  p[Z^Cl𓾂
+     *  @param  percentile  0`100
+     */
+    int64_t GetValueAtPercentile(float64 percentile) const
+    {
+        if (m_count == 0) {
+            return 0;
+        }
+        int64_t target = static_cast<int64_t>(m_count*percentile/100.0 + 0.5);
+        if (target < 1) {
+            target = 1;
+        }
+        int64_t total = 0;
+        for (size_t inx = 0; inx < m_bucket.size(); inx++) {
+            total += m_bucket[inx];
+            if (total >= target) {
+                const int64_t value = ToUpperValue(static_cast<int32_t>(inx));
+                return (value > m_max) ?m_max :value;
+            }
+        }
+        return m_max;
+    }
+
+    int64_t GetCount() const { return m_count; }
+    int64_t GetMin() const { return m_min; }
+    int64_t GetMax() const { return m_max; }
+    int64_t GetMean() const { return (m_count > 0) ?m_sum/m_count :0; }
+};
+
+} // namespace trading
@@ -0,0 +1,474 @@
+/*!
+ *  @file   linux_main.cpp
+ *  @brief  linuxpGg|Cg(EBhEȂ풓)
+ *  @date   2018/01/27
+ *  @note   win_main.cpp̃bZ[W[v(PeekMessage+Sleep(1))epoll/timerfd/eventfdɒu
+ *  @note   ̊(^C}[/UpdateԊȗ)Mʂ̓܂Ŗ
+ *  @note   NƂɊOݒǂݍ݁Ałg[hJn
+ *  @note   VOi SIGINT/SIGTERM:I SIGUSR1:Oo SIGUSR2:ꎞ~
+ */
+#if defined(__linux__)
+
+#include "allocation_tracker.h"
+#include "environment.h"
+#include "thread_affinity.h"
+#include "trade_assistor.h"
+#include "update_message.h"
+
+#include "utility/utility_datetime.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <codecvt>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <locale>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace
+{
+
+// 萔
+const int64_t UPDATE_INTV_MS = 32; //!< UpdateԊu[~b](win_mainƓ/M΂葁)
+const int32_t MAX_EVENTS = 4;      //!< epoll_waitŎ󂯎Cxg
+
+/*!
+ *  @brief  N
+ */
+struct LaunchOption
+{
+    bool m_b_daemon;            //!< 풓([؂藣)
+    int32_t m_credential_fd;    //!< ڑǂݍރt@CfBXNv^(-1Ȃ[œ)
+    std::string m_log_file;     //!< 풓̃bZ[Wo͐(Ȃ̂Ă)
+
+    LaunchOption()
+    : m_b_daemon(false)
+    , m_credential_fd(-1)
+    , m_log_file()
+    {
+    }
+};
+
+/*!
+ *  @brief  ڑ
+ *  @note   g[hJnn
+ */
+struct Credential
+{
+    std::wstring m_uid;
+    std::wstring m_pwd;
+    std::wstring m_pwd_sub;
+
+    /*!
+     *  @brief  
+     *  @note   ɎcȂ悤㏑Ăɂ
+     */
+    void Clear()
+    {
+        for (std::wstring* str: { &m_uid, &m_pwd, &m_pwd_sub }) {
+            std::fill(str->begin(), str->end(), L'\0');
+            str->clear();
+        }
+    }
+};
+
+/*!
+ *  @brief  g\
+ *  @param  name    vO
+ */
+void PrintUsage(const char* name)
+{
+    std::cerr << "usage: " << name << " [-d] [-f fd] [-l logfile]" << std::endl;
+    std::cerr << "  -d          daemonize" << std::endl;
+    std::cerr << "  -f fd       read uid/pwd/pwd_sub (one per line, UTF-8) from fd" << std::endl;
+    std::cerr << "  -l logfile  write messages to logfile while daemonized" << std::endl;
+}
+
+/*!
+ *  @brief  N
+ *  @param[in]  argc
+ *  @param[in]  argv
+ *  @param[out] dst     i[
+ *  @retval true    
+ */
+bool ParseOption(int argc, char* argv[], LaunchOption& dst)
+{
+    int opt = 0;
+    while ((opt = getopt(argc, argv, "df:l:")) != -1) {
+        switch (opt)
+        {
+        case 'd':
+            dst.m_b_daemon = true;
+            break;
+        case 'f':
+            dst.m_credential_fd = std::atoi(optarg);
+            if (dst.m_credential_fd < 0) {
+                return false;
+            }
+            break;
+        case 'l':
+            dst.m_log_file = optarg;
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ *  @brief  t@CfBXNv^ڑǂ
+ *  @param[in]  fd  t@CfBXNv^(ǂݏI)
+ *  @param[out] dst i[
+ *  @retval true    
+ *  @note   1suid/2spwd/3spwd_sub(UTF-8)
+ */
+bool ReadCredentialFromFD(int32_t fd, Credential& dst)
+{
+    std::string buffer;
+    char rbuf[256];
+    for (;;) {
+        const ssize_t len = read(fd, rbuf, sizeof(rbuf));
+        if (len > 0) {
+            buffer.append(rbuf, static_cast<size_t>(len));
+        } else if (len == 0 || errno != EINTR) {
+            break;
+        }
+    }
+    close(fd);
+    std::fill(rbuf, rbuf + sizeof(rbuf), '\0');
+    //
+    std::vector<std::string> lines(1);
+    for (char c: buffer) {
+        if (c == '\n') {
+            lines.emplace_back();
+        } else if (c != '\r') {
+            lines.back().push_back(c);
+        }
+    }
+    std::fill(buffer.begin(), buffer.end(), '\0');
+    bool b_result = false;
+    if (lines.size() >= 3) {
+        std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> cv;
+        dst.m_uid = cv.from_bytes(lines[0]);
+        dst.m_pwd = cv.from_bytes(lines[1]);
+        dst.m_pwd_sub = cv.from_bytes(lines[2]);
+        b_result = !dst.m_uid.empty() && !dst.m_pwd.empty() && !dst.m_pwd_sub.empty();
+    }
+    for (auto& line: lines) {
+        std::fill(line.begin(), line.end(), '\0');
+    }
+    return b_result;
+}
+
+/*!
+ *  @brief  [1s
+ *  @param[in]  prompt  ͈ē
+ *  @param[in]  b_echo  ͕\邩
+ *  @param[out] dst     i[
+ *  @retval true    
+ */
+bool PromptLine(const char* prompt, bool b_echo, std::wstring& dst)
+{
+    std::cerr << prompt << std::flush;
+    termios old_tio;
+    const bool b_tty = (tcgetattr(STDIN_FILENO, &old_tio) == 0);
+    if (b_tty && !b_echo) {
+        termios new_tio(old_tio);
+        new_tio.c_lflag &= ~ECHO;
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &new_tio);
+    }
+    std::string line;
+    const bool b_read = static_cast<bool>(std::getline(std::cin, line));
+    if (b_tty && !b_echo) {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &old_tio);
+        std::cerr << std::endl;
+    }
+    if (b_read) {
+        std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> cv;
+        dst = cv.from_bytes(line);
+    }
+    std::fill(line.begin(), line.end(), '\0');
+    return b_read && !dst.empty();
+}
+
+/*!
+ *  @brief  [ڑ
+ *  @param[out] dst i[
+ *  @retval true    
+ */
+bool PromptCredential(Credential& dst)
+{
+    return PromptLine("uid: ", true, dst.m_uid) &&
+           PromptLine("pwd: ", false, dst.m_pwd) &&
+           PromptLine("pwd_sub: ", false, dst.m_pwd_sub);
+}
+
+/*!
+ *  @brief  [؂藣ď풓
+ *  @param  log_file    bZ[Wo͐(Ȃ̂Ă)
+ *  @retval true    (qvZXƂĖ߂)
+ *  @note   ƃfBNg͕ςȂ(ݒt@C𑊑΃pXœǂނ)
+ */
+bool Daemonize(const std::string& log_file)
+{
+    pid_t pid = fork();
+    if (pid < 0) {
+        return false;
+    } else if (pid > 0) {
+        _exit(EXIT_SUCCESS);
+    }
+    if (setsid() < 0) {
+        return false;
+    }
+    pid = fork();
+    if (pid < 0) {
+        return false;
+    } else if (pid > 0) {
+        _exit(EXIT_SUCCESS);
+    }
+    umask(027);
+    //
+    const int null_fd = open("/dev/null", O_RDWR | O_CLOEXEC);
+    const int out_fd = (log_file.empty())
+                       ?null_fd
+                       :open(log_file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0640);
+    if (null_fd < 0 || out_fd < 0) {
+        return false;
+    }
+    dup2(null_fd, STDIN_FILENO);
+    dup2(out_fd, STDOUT_FILENO);
+    dup2(out_fd, STDERR_FILENO);
+    if (out_fd != null_fd) {
+        close(out_fd);
+    }
+    close(null_fd);
+    return true;
+}
+
+/*!
+ *  @brief  Update^C}[ݒ
+ *  @param  fd          timerfd
+ *  @param  delay_ms    ܂ł̎[~b](0ȉȂ炷)
+ *  @retval true        
+ *  @note   񂫂(Ȃ)Őݒ肷(UpdatêтɎ̊Őݒ肵)
+ */
+bool ArmUpdateTimer(int fd, int64_t delay_ms)
+{
+    const int64_t NS_PER_MS = 1000*1000;
+    const int64_t NS_PER_SEC = 1000*NS_PER_MS;
+    const int64_t delay_ns = std::max<int64_t>(delay_ms * NS_PER_MS, 1); // 0͉ɂȂĂ܂
+    itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec = static_cast<time_t>(delay_ns / NS_PER_SEC);
+    spec.it_value.tv_nsec = static_cast<long>(delay_ns % NS_PER_SEC);
+    return timerfd_settime(fd, 0, &spec, nullptr) == 0;
+}
+
+/*!
+ *  @brief  Update^C}[
+ *  @return timerfd(s-1)
+ */
+int CreateUpdateTimer()
+{
+    const int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    if (!ArmUpdateTimer(fd, UPDATE_INTV_MS)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*!
+ *  @brief  Update܂ł̎Ԃ𓾂
+ *  @param  trade_assistant
+ *  @param  tickCount       ݂tickCount
+ *  @return Update܂ł̎[~b](^C}[UpdateԊȗ/1~bȏ)
+ */
+int64_t GetUpdateDelay(const trading::TradeAssistor& trade_assistant, int64_t tickCount)
+{
+    const int64_t next_tick = trade_assistant.GetNextUpdateTick();
+    if (next_tick < 0) {
+        return UPDATE_INTV_MS;
+    }
+    // ~bŉ񂵒Ȃ(0~b̊u^C}[ŋ肵Ȃ悤)
+    return std::max<int64_t>(1, std::min(next_tick - tickCount, UPDATE_INTV_MS));
+}
+
+/*!
+ *  @brief  epollւ̓ǂݍ݊Ďo^
+ *  @param  epfd    epoll
+ *  @param  fd      ĎΏ
+ *  @retval true    
+ */
+bool AddReadEvent(int epfd, int fd)
+{
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    return epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+
+} // namespace
+
+/*!
+ *  @brief  main
+ */
+int main(int argc, char* argv[])
+{
+    LaunchOption option;
+    if (!ParseOption(argc, argv, option)) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // ڑ͏풓O([邤)ɓĂ
+    Credential credential;
+    const bool b_credential = (option.m_credential_fd >= 0)
+                              ?ReadCredentialFromFD(option.m_credential_fd, credential)
+                              :PromptCredential(credential);
+    if (!b_credential) {
+        std::cerr << "failed to read credential" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (option.m_b_daemon && !Daemonize(option.m_log_file)) {
+        credential.Clear();
+        return EXIT_FAILURE;
+    }
+
+    // VOisignalfdŎ󂯂
+    // http֘AXbhɌp邽߃Xbh(TradeAssistor)OɃubNĂ
+    sigset_t sigmask;
+    sigemptyset(&sigmask);
+    sigaddset(&sigmask, SIGINT);
+    sigaddset(&sigmask, SIGTERM);
+    sigaddset(&sigmask, SIGUSR1);
+    sigaddset(&sigmask, SIGUSR2);
+    sigprocmask(SIG_BLOCK, &sigmask, nullptr);
+    signal(SIGPIPE, SIG_IGN);
+
+    const int epfd = epoll_create1(EPOLL_CLOEXEC);
+    const int sigfd = signalfd(-1, &sigmask, SFD_NONBLOCK | SFD_CLOEXEC);
+    const int timerfd = CreateUpdateTimer();
+    const int wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epfd < 0 || sigfd < 0 || timerfd < 0 || wakefd < 0 ||
+        !AddReadEvent(epfd, sigfd) || !AddReadEvent(epfd, timerfd) || !AddReadEvent(epfd, wakefd)) {
+        std::cerr << "failed to create event loop: " << strerror(errno) << std::endl;
+        credential.Clear();
+        return EXIT_FAILURE;
+    }
+
+    // [U[
+    std::shared_ptr<Environment> environment(Environment::Create());
+    std::shared_ptr<trading::TradeAssistor> trade_assistant(std::make_shared<trading::TradeAssistor>());
+    trade_assistant->ReadSetting();
+    // Mʂꂽ烋[vN(http֘AXbhĂ΂)
+    trade_assistant->SetWakeUpHandler([wakefd]()
+    {
+        const uint64_t one = 1;
+        if (write(wakefd, &one, sizeof(one)) != sizeof(one)) {
+            // JE^(NĂȂ܂ܑʂɓꂽ)s  NΑŜŖȂ
+        }
+    });
+    // Xbh(̃Xbh)̔zu
+    // ȍ~ɐXbh͊eŔzu(CPUŒSCHED_FIFOpȂ)
+    trading::thread_affinity::CaptureProcessCPU();
+    if (!trading::thread_affinity::ApplyCurrentThread(trading::thread_affinity::ROLE_TRADING)) {
+        std::cerr << "failed to apply trading thread setting" << std::endl;
+    }
+
+    // C[v:^C}[/Mʓ/VOiM܂Ŗ
+    bool b_started = false;
+    bool b_quit = false;
+    epoll_event events[MAX_EVENTS];
+    while (!b_quit) {
+        const int num_ev = epoll_wait(epfd, events, MAX_EVENTS, -1);
+        if (num_ev < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "epoll_wait: " << strerror(errno) << std::endl;
+            break;
+        }
+        bool b_update = false;
+        for (int inx = 0; inx < num_ev; inx++) {
+            const int fd = events[inx].data.fd;
+            if (fd == sigfd) {
+                signalfd_siginfo si;
+                while (read(sigfd, &si, sizeof(si)) == sizeof(si)) {
+                    switch (si.ssi_signo)
+                    {
+                    case SIGUSR1:
+                        trade_assistant->OutputLog();
+                        break;
+                    case SIGUSR2:
+                        trade_assistant->Pause();
+                        break;
+                    default:
+                        b_quit = true;
+                        break;
+                    }
+                }
+            } else if (fd == timerfd || fd == wakefd) {
+                // /񐔂͓ǂݎ̂Ă(͂ĂMʂUpdateł܂Ƃ߂ď)
+                uint64_t count = 0;
+                if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+                    b_update = true;
+                }
+            }
+        }
+        if (b_update && !b_quit) {
+            TRADE_ALLOCATION_SCOPE(SECTION_FRAME);
+            const int64_t tickCount = garnet::utility_datetime::GetTickCountGeneral();
+            if (!b_started && trade_assistant->IsReady()) {
+                // g[hJn{^
+                trade_assistant->Start(tickCount,
+                                       credential.m_uid,
+                                       credential.m_pwd,
+                                       credential.m_pwd_sub);
+                credential.Clear();
+                b_started = true;
+            }
+            UpdateMessage trading_message;
+            trade_assistant->Update(tickCount, trading_message);
+            trading_message.OutputMessage();
+            std::cout << std::flush;
+            // ̊Őݒ肵(MʂŋNꍇ𐔂)
+            const int64_t now_tick = garnet::utility_datetime::GetTickCountGeneral();
+            if (!ArmUpdateTimer(timerfd, GetUpdateDelay(*trade_assistant, now_tick))) {
+                std::cerr << "timerfd_settime: " << strerror(errno) << std::endl;
+                break;
+            }
+        }
+    }
+
+    credential.Clear();
+    // http֘AXbhʒmgȂȂĂ
+    trade_assistant.reset();
+    close(wakefd);
+    close(timerfd);
+    close(sigfd);
+    close(epfd);
+    return EXIT_SUCCESS;
+}
+
+#endif/* defined(__linux__) */
@@ -0,0 +1,110 @@
+/*!
+ *  @file   mpsc_queue.h
+ *  @brief  YҒP҃L[(lock-free)
+ *  @date   2018/01/27
+ *  @note   httpXbh()Xbh(P)ւ̎Mʎ󂯓np
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <utility>
+
+namespace trading
+{
+
+/*!
+ *  @brief  YҒP҃L[
+ *  @note   Push:Cӂ̃XbhĂŗǂ(wait-free)
+ *  @note   Pop:P̏Xbĥ݌ĂԂ
+ *  @note   ԕm[htPXg(Vyukov^)
+ *  @note   Push̐Y҂ƌ㑱vfꎞIɌȂƂ(PopŎ)
+ */
+template<typename T>
+class MpscQueue
+{
+private:
+    /*!
+     *  @brief  m[h
+     */
+    struct Node
+    {
+        std::atomic<Node*> m_next;  //!< m[h
+        T m_value;                  //!< vf
+
+        Node()
+        : m_next(nullptr)
+        , m_value()
+        {
+        }
+        explicit Node(T&& value)
+        : m_next(nullptr)
+        , m_value(std::move(value))
+        {
+        }
+    };
+
+    std::atomic<Node*> m_head;  //!< Ōɐς܂ꂽm[h(Yґ)
+    Node* m_tail;               //!< ԕm[h(ґ) m_tail->m_next擪vf
+
+    MpscQueue(const MpscQueue&);
+    MpscQueue(MpscQueue&&);
+    MpscQueue& operator= (const MpscQueue&);
+
+public:
+    MpscQueue()
+    : m_head(nullptr)
+    , m_tail(new Node())
+    {
+        m_head.store(m_tail, std::memory_order_relaxed);
+    }
+    /*!
+     *  @note   oȂvf͔j
+     */
+    ~MpscQueue()
+    {
+        Node* node = m_tail;
+        while (node != nullptr) {
+            Node* next = node->m_next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    /*!
+     *  @brief  vfς
+     *  @param  value   vf
+     */
+    void Push(T value)
+    {
+        Node* node = new Node(std::move(value));
+        Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    /*!
+     *  @brief  vfo
+     *  @param[out] dst i[
+     *  @retval true    o
+     */
+    bool Pop(T& dst)
+    {
+        Node* next = m_tail->m_next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        // om[hVȔԕɂ
+        dst = std::move(next->m_value);
+        next->m_value = T();
+        delete m_tail;
+        m_tail = next;
+        return true;
+    }
+};
+
+//! M(httpXbhōAXbhœKp鏈) Me͒lŃLv`邱
+typedef std::function<void()> ResultMessage;
+//! Mʓ֐
+typedef std::function<void(const ResultMessage&)> PostResultFunc;
+
+} // namespace trading
@@ -0,0 +1,404 @@
+/*!
+ *  @file   scope_profiler.cpp
+ *  @brief  Ԍv
+ *  @date   2018/01/30
+ */
+#include "scope_profiler.h"
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace trading
+{
+
+namespace
+{
+/*!
+ *  @brief  vԖ𓾂
+ *  @param  phase   v
+ */
+const char* GetPhaseName(ScopeProfiler::ePhase phase)
+{
+    switch (phase)
+    {
+    case ScopeProfiler::PHASE_UPDATE:               return "update";
+    case ScopeProfiler::PHASE_APPLY_RESULT:         return "apply_result";
+    case ScopeProfiler::PHASE_MAIN_TRADE:           return "main_trade";
+    case ScopeProfiler::PHASE_ORDERING_UPDATE:      return "ordering_update";
+    case ScopeProfiler::PHASE_INTERPRET_TACTICS:    return "interpret_tactics";
+    case ScopeProfiler::PHASE_LUA_CALL:             return "lua_call";
+    case ScopeProfiler::PHASE_ENTRY_COMMAND:        return "entry_command";
+    case ScopeProfiler::PHASE_ISSUE_ORDER:          return "issue_order";
+    case ScopeProfiler::PHASE_PREFETCH_ORDER:       return "prefetch_order";
+    case ScopeProfiler::PHASE_HTML_PARSE:           return "html_parse";
+    default:                                        return "unknown";
+    }
+}
+
+/*!
+ *  @brief  v(1ԕ)
+ */
+struct ProfileEvent
+{
+    ScopeProfiler::ePhase m_phase;  //!< v
+    int64_t m_begin_stamp;          //!< ԊJn[}CNb]
+    int64_t m_end_stamp;            //!< ԏI[}CNb]
+};
+
+/*!
+ *  @brief  Xbhʌv
+ *  @note   ͎̂̃Xbh(r͏o͎̓ǂݏoƂ̊ԂłȂ)
+ */
+class ThreadRecord
+{
+private:
+    enum
+    {
+        RING_CAPACITY = 1 << 16,    //!< Oobt@e(30fpsŋ8Ȃ4x)
+    };
+
+    mutable std::mutex m_mtx;               //!< rq
+    const int32_t m_tid;                    //!< o^̔ԍ(o͗pXbhID)
+    std::vector<ProfileEvent> m_ring;       //!< Oobt@
+    size_t m_next;                          //!< ̏ʒu
+    bool m_b_wrap;                          //!< 
+    LatencyHistogram m_histogram[ScopeProfiler::NUM_PHASE]; //!< ԕʃqXgO
+
+    ThreadRecord(const ThreadRecord&);
+    ThreadRecord& operator= (const ThreadRecord&);
+
+public:
+    explicit ThreadRecord(int32_t tid)
+    : m_mtx()
+    , m_tid(tid)
+    , m_ring(RING_CAPACITY)
+    , m_next(0)
+    , m_b_wrap(false)
+    , m_histogram()
+    {
+    }
+
+    int32_t GetTID() const { return m_tid; }
+
+    /*!
+     *  @brief  L^
+     *  @param  phase       v
+     *  @param  begin_stamp ԊJn[}CNb]
+     *  @param  end_stamp   ԏI[}CNb]
+     */
+    void Record(ScopeProfiler::ePhase phase, int64_t begin_stamp, int64_t end_stamp)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        ProfileEvent& ev(m_ring[m_next]);
+        ev.m_phase = phase;
+        ev.m_begin_stamp = begin_stamp;
+        ev.m_end_stamp = end_stamp;
+        if (++m_next >= m_ring.size()) {
+            m_next = 0;
+            m_b_wrap = true;
+        }
+        m_histogram[phase].Record(end_stamp - begin_stamp);
+    }
+
+    /*!
+     *  @brief  Oobt@̓e𓾂(Â)
+     *  @param[out] dst i[(ɒǉ)
+     */
+    void CopyEvents(std::vector<ProfileEvent>& dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_b_wrap) {
+            dst.insert(dst.end(), m_ring.begin() + m_next, m_ring.end());
+        }
+        dst.insert(dst.end(), m_ring.begin(), m_ring.begin() + m_next);
+    }
+    /*!
+     *  @brief  ԕʃqXgOZ
+     *  @param[out] dst Z(NUM_PHASE)
+     */
+    void AddHistogram(LatencyHistogram* dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        for (int32_t inx = 0; inx < ScopeProfiler::NUM_PHASE; inx++) {
+            dst[inx].Add(m_histogram[inx]);
+        }
+    }
+};
+
+/*!
+ *  @brief  Ԃ̓qHĎȎԂWv(flamegraphp)
+ *  @param[in]  prefix  q̐擪ɕt閼O(Xbh)
+ *  @param[in]  events  1Xbȟv(Jn/Ȃ璷)
+ *  @param[out] dst     q̌oHȎ[}CNb]
+ */
+void FoldEvents(const std::string& prefix,
+                const std::vector<ProfileEvent>& events,
+                std::map<std::string, int64_t>& dst)
+{
+    struct Frame
+    {
+        const ProfileEvent* m_event;
+        int64_t m_child_us;
+        std::string m_path;
+    };
+    std::vector<Frame> stack;
+    const auto pop = [&stack, &dst]()
+    {
+        const Frame& top(stack.back());
+        const int64_t dur_us = top.m_event->m_end_stamp - top.m_event->m_begin_stamp;
+        dst[top.m_path] += std::max<int64_t>(dur_us - top.m_child_us, 0);
+        stack.pop_back();
+        if (!stack.empty()) {
+            stack.back().m_child_us += dur_us;
+        }
+    };
+    for (const auto& ev: events) {
+        // /qɂȂȂ(Oobt@̐؂)͔
+        while (!stack.empty() && (stack.back().m_event->m_end_stamp <= ev.m_begin_stamp ||
+                                  stack.back().m_event->m_end_stamp < ev.m_end_stamp)) {
+            pop();
+        }
+        Frame frame;
+        frame.m_event = &ev;
+        frame.m_child_us = 0;
+        frame.m_path = (stack.empty() ?prefix :stack.back().m_path) + ";" + GetPhaseName(ev.m_phase);
+        stack.emplace_back(std::move(frame));
+    }
+    while (!stack.empty()) {
+        pop();
+    }
+}
+
+} // namespace
+
+class ScopeProfiler::PIMPL
+{
+private:
+    mutable std::mutex m_mtx;   //!< rq
+    const int32_t m_generation; //!< ԍ(Xbh̃LbṼCX^X̂̂肷)
+    std::vector<std::shared_ptr<ThreadRecord>> m_record;    //!< Xbhʌv
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  ԍ𔭍s
+     */
+    static int32_t IssueGeneration()
+    {
+        static std::atomic<int32_t> generation(0);
+        return ++generation;
+    }
+
+    /*!
+     *  @brief  ďoXbȟvʂ𓾂
+     *  @note   ͓o^
+     */
+    ThreadRecord& GetThreadRecord()
+    {
+        static thread_local int32_t t_generation = 0;
+        static thread_local ThreadRecord* t_record = nullptr;
+        if (t_generation != m_generation) {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            const int32_t tid = static_cast<int32_t>(m_record.size()) + 1;
+            m_record.emplace_back(std::make_shared<ThreadRecord>(tid));
+            t_record = m_record.back().get();
+            t_generation = m_generation;
+        }
+        return *t_record;
+    }
+
+    /*!
+     *  @brief  o^ς݂̃Xbhʌvʂ𓾂
+     */
+    std::vector<std::shared_ptr<ThreadRecord>> GetRecords() const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        return m_record;
+    }
+
+    /*!
+     *  @brief  ԕʏWvo
+     *  @param  filename    o̓t@C
+     *  @param  records     Xbhʌv
+     */
+    static void OutputSummary(const std::string& filename,
+                              const std::vector<std::shared_ptr<ThreadRecord>>& records)
+    {
+        std::vector<LatencyHistogram> histogram(NUM_PHASE);
+        for (const auto& rec: records) {
+            rec->AddHistogram(histogram.data());
+        }
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "phase,count,min,mean,p50,p90,p99,max" << std::endl;
+        for (int32_t inx = 0; inx < NUM_PHASE; inx++) {
+            const LatencyHistogram& h(histogram[inx]);
+            if (h.GetCount() == 0) {
+                continue;
+            }
+            outputfile << GetPhaseName(static_cast<ePhase>(inx)) << ",";
+            outputfile << h.GetCount() << "," << h.GetMin() << "," << h.GetMean() << ",";
+            outputfile << h.GetValueAtPercentile(50.0) << "," << h.GetValueAtPercentile(90.0) << ",";
+            outputfile << h.GetValueAtPercentile(99.0) << "," << h.GetMax() << std::endl;
+        }
+        outputfile.close();
+    }
+
+    /*!
+     *  @brief  Chrome trace/flamegrapho
+     *  @param  trace_filename  Chrome traceo̓t@C
+     *  @param  folded_filename flamegrapho̓t@C
+     *  @param  records         Xbhʌv
+     */
+    static void OutputTrace(const std::string& trace_filename,
+                            const std::string& folded_filename,
+                            const std::vector<std::shared_ptr<ThreadRecord>>& records)
+    {
+        std::ofstream trace_file(trace_filename.c_str());
+        std::map<std::string, int64_t> folded;
+        trace_file << "{\"traceEvents\":[";
+        bool b_first = true;
+        std::vector<ProfileEvent> events;
+        for (const auto& rec: records) {
+            events.clear();
+            rec->CopyEvents(events);
+            const int32_t tid = rec->GetTID();
+            for (const auto& ev: events) {
+                trace_file << ((b_first) ?"\n" :",\n");
+                trace_file << "{\"name\":\"" << GetPhaseName(ev.m_phase) << "\",\"ph\":\"X\",\"pid\":1,";
+                trace_file << "\"tid\":" << tid << ",\"ts\":" << ev.m_begin_stamp << ",";
+                trace_file << "\"dur\":" << (ev.m_end_stamp - ev.m_begin_stamp) << "}";
+                b_first = false;
+            }
+            // Ԃ͏IɋL^̂ŊJn(ȂŐԂ)ɕגĒH
+            std::stable_sort(events.begin(), events.end(), [](const ProfileEvent& l, const ProfileEvent& r)
+            {
+                if (l.m_begin_stamp != r.m_begin_stamp) {
+                    return l.m_begin_stamp < r.m_begin_stamp;
+                }
+                return l.m_end_stamp > r.m_end_stamp;
+            });
+            FoldEvents("thread" + std::to_string(tid), events, folded);
+        }
+        trace_file << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+        trace_file.close();
+        //
+        std::ofstream folded_file(folded_filename.c_str());
+        for (const auto& f: folded) {
+            folded_file << f.first << " " << f.second << std::endl;
+        }
+        folded_file.close();
+    }
+
+public:
+    PIMPL()
+    : m_mtx()
+    , m_generation(IssueGeneration())
+    , m_record()
+    {
+    }
+
+    /*!
+     *  @brief  ԎԂL^
+     *  @param  phase       v
+     *  @param  begin_stamp ԊJn[}CNb]
+     *  @param  end_stamp   ԏI[}CNb]
+     */
+    void Record(ePhase phase, int64_t begin_stamp, int64_t end_stamp)
+    {
+        if (phase >= NUM_PHASE) {
+            return;
+        }
+        GetThreadRecord().Record(phase, begin_stamp, end_stamp);
+    }
+
+    /*!
+     *  @brief  vʏo
+     *  @param  log_dir     o̓fBNg
+     *  @param  date_str    N(t@Cp)
+     */
+    void OutputLog(const std::string& log_dir, const std::string& date_str) const
+    {
+        const std::vector<std::shared_ptr<ThreadRecord>> records(GetRecords());
+        const std::string base(log_dir + "profile_" + date_str);
+        OutputSummary(base + ".csv", records);
+        OutputTrace(base + ".json", base + ".folded", records);
+    }
+};
+
+//! g̎Q
+std::weak_ptr<ScopeProfiler> ScopeProfiler::m_pInstance;
+
+/*!
+ *  @brief  CX^X(static)
+ *  @return CX^XL|C^
+ */
+std::shared_ptr<ScopeProfiler> ScopeProfiler::Create()
+{
+    if (m_pInstance.lock()) {
+        std::shared_ptr<ScopeProfiler> _empty_instance;
+        return _empty_instance;
+    } else {
+        std::shared_ptr<ScopeProfiler> _instance(new ScopeProfiler());
+        m_pInstance = _instance;
+        return _instance;
+    }
+}
+
+/*!
+ *  @brief  vp𓾂(static)
+ *  @return P[}CNb]
+ */
+int64_t ScopeProfiler::GetTimeStamp()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/*!
+ *  @brief  ԎԂL^(static)
+ *  @param  phase       v
+ *  @param  begin_stamp ԊJn[}CNb]
+ *  @param  end_stamp   ԏI[}CNb]
+ */
+void ScopeProfiler::Record(ePhase phase, int64_t begin_stamp, int64_t end_stamp)
+{
+    std::shared_ptr<ScopeProfiler> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->Record(phase, begin_stamp, end_stamp);
+    }
+}
+
+/*!
+ *  @brief  vʏo(static)
+ *  @param  log_dir     o̓fBNg
+ *  @param  date_str    N(t@Cp)
+ */
+void ScopeProfiler::OutputLog(const std::string& log_dir, const std::string& date_str)
+{
+    std::shared_ptr<const ScopeProfiler> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->OutputLog(log_dir, date_str);
+    }
+}
+
+/*!
+ */
+ScopeProfiler::ScopeProfiler()
+: m_pImpl(new PIMPL())
+{
+}
+/*!
+ */
+ScopeProfiler::~ScopeProfiler()
+{
+}
+
+} // namespace trading
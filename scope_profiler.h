@@ -0,0 +1,131 @@
+/*!
+ *  @file   scope_profiler.h
+ *  @brief  Ԍv
+ *  @date   2018/01/30
+ *  @note   UpdatȅԂeɂǂzĂ邩𒲂ׂ邽߂̌v
+ *  @note   trade_debug.hDEBUG_SCOPE_PROFILER0ȂTRADE_PROFILE_SCOPE͉ߍ܂Ȃ
+ */
+#pragma once
+
+#include "trade_debug.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace trading
+{
+
+/*!
+ *  @brief  Ԍv
+ *  @note   singleton
+ *  @note   CX^X͖Iɐ(ďoshared_ptrŕێ)
+ *  @note   vʂ̓XbhƂ̃Oobt@(ߕ)ƋԕʃqXgO(S)ɋL^
+ */
+class ScopeProfiler
+{
+public:
+    /*!
+     *  @brief  v
+     */
+    enum ePhase
+    {
+        PHASE_UPDATE = 0,           //!< UpdateS
+        PHASE_APPLY_RESULT,         //!< MʓKp
+        PHASE_MAIN_TRADE,           //!< XVF
+        PHASE_ORDERING_UPDATE,      //!< ǗUpdate
+        PHASE_INTERPRET_TACTICS,    //!< 헪
+        PHASE_LUA_CALL,             //!< XNvg֐Ăяo
+        PHASE_ENTRY_COMMAND,        //!< ߓo^
+        PHASE_ISSUE_ORDER,          //!< ߏ()
+        PHASE_PREFETCH_ORDER,       //!< ͐ǂ
+        PHASE_HTML_PARSE,           //!< html
+
+        NUM_PHASE
+    };
+
+    /*!
+     *  @brief  Ԍvq
+     *  @note   j܂ł1ԂƂċL^
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(ePhase phase)
+        : m_phase(phase)
+        , m_begin_stamp(GetTimeStamp())
+        {
+        }
+        ~Scope()
+        {
+            Record(m_phase, m_begin_stamp, GetTimeStamp());
+        }
+
+    private:
+        Scope(const Scope&);
+        Scope& operator= (const Scope&);
+
+        ePhase m_phase;         //!< v
+        int64_t m_begin_stamp;  //!< ԊJn[}CNb]
+    };
+
+    /*!
+     *  @brief  CX^X + 
+     *  @return CX^XL|C^
+     *  @note   ς݂Ȃshared_ptrԂ
+     */
+    static std::shared_ptr<ScopeProfiler> Create();
+
+    /*!
+     *  @brief  vp𓾂
+     *  @return P[}CNb]
+     */
+    static int64_t GetTimeStamp();
+
+    /*!
+     *  @brief  ԎԂL^
+     *  @param  phase       v
+     *  @param  begin_stamp ԊJn[}CNb]
+     *  @param  end_stamp   ԏI[}CNb]
+     *  @note   ďoXbh̃Oobt@ɏ(̓obt@o^)
+     */
+    static void Record(ePhase phase, int64_t begin_stamp, int64_t end_stamp);
+
+    /*!
+     *  @brief  vʏo
+     *  @param  log_dir     o̓fBNg
+     *  @param  date_str    N(t@Cp)
+     *  @note   profile_[date].csv      ԕʏWv(count/min/mean/p50/p90/p99/max[}CNb])
+     *  @note   profile_[date].json     Chrome trace`(chrome://tracingœǂ)
+     *  @note   profile_[date].folded   flamegraph.pl`(Ԃ̓qƂ̎Ȏ[}CNb])
+     */
+    static void OutputLog(const std::string& log_dir, const std::string& date_str);
+
+    /*!
+     */
+    ~ScopeProfiler();
+
+private:
+    ScopeProfiler();
+    ScopeProfiler(const ScopeProfiler&);
+    ScopeProfiler(ScopeProfiler&&);
+    ScopeProfiler& operator= (const ScopeProfiler&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+
+    //! g̎Q
+    static std::weak_ptr<ScopeProfiler> m_pInstance;
+};
+
+} // namespace trading
+
+#if defined(DEBUG_SCOPE_PROFILER) && (DEBUG_SCOPE_PROFILER != 0)
+#define TRADE_PROFILE_SCOPE_NAME2(line) trade_profile_scope_##line
+#define TRADE_PROFILE_SCOPE_NAME(line)  TRADE_PROFILE_SCOPE_NAME2(line)
+//! Ԍv(XR[v𔲂܂)
+#define TRADE_PROFILE_SCOPE(phase) \
+    const trading::ScopeProfiler::Scope TRADE_PROFILE_SCOPE_NAME(__LINE__)(trading::ScopeProfiler::phase)
+#else
+#define TRADE_PROFILE_SCOPE(phase)
+#endif/* DEBUG_SCOPE_PROFILER */
@@ -80,11 +80,14 @@ public:
     /*!
      *  @brief  Ďif[^擾
      *  @param  callback    R[obN
+     *  @note   OƓeςĂȂΉif[^̂܂ܐԂƂ
+     *  @note   Ov̉҂͗vȂƂ(callback͌Ă΂Ȃ)
      */
     virtual void UpdateValueData(const UpdateValueDataCallback& callback) = 0;
     /*!
      *  @brief  擾擾
      *  @param  callback    R[obN
+     *  @note   Ov̉҂͗vȂƂ(callback͌Ă΂Ȃ)
      */
     virtual void UpdateExecuteInfo(const UpdateStockExecInfoCallback& callback) = 0;
     /*!
@@ -128,7 +131,33 @@ public:
      *  @param  callback    R[obN
      */
     virtual void CancelOrder(int32_t order_id, const std::wstring& pwd, const OrderCallback& callback) = 0;
+    /*!
+     *  @brief  ͐ǂ
+     *  @param  order   (i͖ŗǂ)
+     *  @note   gK[߂̓̓Xebvɍς܂Ă
+     *  @note   ʂ̓ZbVɕێAɎg(gp邩؂Ŕj)
+     */
+    virtual void PrefetchOrderInput(const StockOrder& order) = 0;
+    /*!
+     *  @brief  ڑOm
+     *  @note   JnOɌĂсADNS/TCPڑ/TLSnhVFCNς܂Ă
+     *  @note   ͎gȂ(sĂ̗vŌq)
+     */
+    virtual void PrewarmConnection() = 0;
+
 
+    /*!
+     *  @brief  ڑvo
+     *  @param  log_dir o̓fBNg
+     *  @param  date    N
+     */
+    virtual void OutputConnectionLog(const std::string& log_dir, const garnet::YYMMDD& date) const = 0;
+    /*!
+     *  @brief  html͓vo
+     *  @param  log_dir o̓fBNg
+     *  @param  date    N
+     */
+    virtual void OutputParserLog(const std::string& log_dir, const garnet::YYMMDD& date) const = 0;
 
     /*!
      *  @brief  ،ЃTCgŏIANZX擾
@@ -4,11 +4,17 @@
  *  @date   2017/05/05
  */
 #include "securities_session_sbi.h"
+#include "trade_debug.h"
 
 #include "environment.h"
+#include "html_parse_worker.h"
+#include "html_parser_sbi.h"
+#include "http_client_pool.h"
+#include "stock_order_latency_tracer.h"
 #include "stock_portfolio.h"
 #include "stock_holdings.h"
 #include "trade_assistant_setting.h"
+#include "trade_datetime.h"
 #include "trade_struct.h"
 #include "trade_utility.h"
 
@@ -24,8 +30,13 @@
 #include "cpprest/http_client.h"
 #include "cpprest/filestream.h"
 
+#include <chrono>
 #include <codecvt>
+#include <cstring>
+#include <fstream>
+#include <iostream>
 #include <mutex>
+#include <unordered_map>
 
 using namespace garnet;
 
@@ -40,6 +51,7 @@ private:
     std::recursive_mutex m_mtx;             //!< rq
     boost::python::api::object m_python;    //!< pythonXNvgIuWFNg
     web::http::cookies_group m_cookies_gr;  //!< SBIpcookieQ
+    HttpClientPool m_http_pool;             //!< http_clientێ(zXgʂɐڑg)
     int64_t m_last_access_tick_mb;          //!< SBI(mobile)֍ŌɃANZX(tickCount)
     int64_t m_last_access_tick_pc;          //!< SBI(PC)֍ŌɃANZX(tickCount)
 
@@ -48,11 +60,165 @@ private:
     const int32_t m_use_pf_number_monitoring;   //!< ĎɎgp|[gtHIԍ
     const int32_t m_pf_indicate_monitoring;     //!< |[gtHI\`FĎ
     const int32_t m_pf_indicate_owned;          //!< |[gtHI\`FۗL
+    const int64_t m_prefetch_expire_ms;         //!< ǂݒ͗L[~b]
+    const bool m_b_native_html_parser;          //!< html͂C++ōs
+
+    /*!
+     *  @brief  ǂݒ
+     *  @note   regist_id擾ɒmF/sURLform data(i/pass/regist_idȊO)𓊋@Iɍ\zĂ
+     */
+    struct PrefetchedOrderInput
+    {
+        std::wstring m_input_url;   //!< URL(mF̃t@)
+        int64_t m_regist_id;        //!< j[NID(Ȃ擾)
+        int64_t m_tick;             //!< 擾(v)(tickCount)
+        int32_t m_number;           //!< \z̒
+        std::wstring m_confirm_url; //!< mFURL(\zς)
+        std::wstring m_execute_url; //!< sURL(\zς)
+        std::wstring m_base_form;   //!< i/pass/regist_idȊOform data(\zς)
+
+        PrefetchedOrderInput()
+        : m_input_url()
+        , m_regist_id(-1)
+        , m_tick(0)
+        , m_number(0)
+        , m_confirm_url()
+        , m_execute_url()
+        , m_base_form()
+        {
+        }
+    };
+    //! ǂݒ<ǂ݃L[, ǂݒ>
+    std::unordered_map<uint64_t, PrefetchedOrderInput> m_prefetch_input;
+    std::mutex m_body_hash_mtx;                 //!< {̃nbVprq
+    //! O͂{̂̃nbV<URL, nbV>
+    std::unordered_map<std::wstring, uint64_t> m_body_hash;
+
+    /*!
+     *  @brief  v
+     */
+    enum ePollingType
+    {
+        POLLING_VALUEDATA = 0,  //!< Ďif[^
+        POLLING_EXECINFO,       //!< 
+
+        NUM_POLLING,
+    };
+    /*!
+     *  @brief  v(1ʕ)
+     */
+    struct PollingState
+    {
+        bool m_b_inflight;      //!< ҂
+        int64_t m_request_tick; //!< Ōɗv(tickCount)
+        uint64_t m_issued_seq;  //!< Ōɔsv̒ʂԍ
+        uint64_t m_applied_seq; //!< Ōɔf̒ʂԍ
+        int64_t m_request;      //!< v
+        int64_t m_skip;         //!< ҂ŏȂv
+        int64_t m_stale;        //!< ÂĎ̂Ă
+
+        PollingState()
+        : m_b_inflight(false)
+        , m_request_tick(0)
+        , m_issued_seq(0)
+        , m_applied_seq(0)
+        , m_request(0)
+        , m_skip(0)
+        , m_stale(0)
+        {
+        }
+    };
+    const int64_t m_polling_inflight_limit_ms;  //!< v҂[~b]
+    mutable std::mutex m_polling_mtx;           //!< vԗprq
+    PollingState m_polling[NUM_POLLING];        //!< v
+    //! v͗prq(ʂ) ʂԍ̊mF猋ʂ̓܂ł1s
+    std::mutex m_polling_parse_mtx[NUM_POLLING];
+    //! html͐pXbh ͏̃oĝōŌɐ錾(ŏɔjăXbh~߂)
+    HtmlParseWorker m_parse_worker;
 
 private:
     PIMPL(const PIMPL&);
     PIMPL& operator= (const PIMPL&);
 
+    /*!
+     *  @brief  regist_id؂o/
+     *  @param  html_u8 ͂response(html/UTF-8)
+     *  @param  type    
+     *  @return regist_id(ȂΕ)
+     *  @note   nativełpythongȂ̂ŃbNsv(|[gtHI擾ƋȂ)
+     */
+    int64_t GetStockOrderRegistID(const std::string& html_u8, eOrderType type)
+    {
+        if (m_b_native_html_parser) {
+            return html_parser_sbi::GetStockOrderRegistID(html_u8, type);
+        }
+        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
+        std::lock_guard<std::recursive_mutex> lock(m_mtx);
+        return boost::python::extract<int64_t>(m_python.attr("getStockOrderRegistID")(html_u8, static_cast<int32_t>(type)));
+    }
+    /*!
+     *  @brief  regist_id؂o/mF
+     *  @param  html_u8 mFresponse(html/UTF-8)
+     *  @param  type    
+     *  @return regist_id(ȂΕ)
+     */
+    int64_t GetStockOrderConfirmRegistID(const std::string& html_u8, eOrderType type)
+    {
+        if (m_b_native_html_parser) {
+            return html_parser_sbi::GetStockOrderConfirmRegistID(html_u8, type);
+        }
+        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
+        std::lock_guard<std::recursive_mutex> lock(m_mtx);
+        return boost::python::extract<int64_t>(m_python.attr("getStockOrderConfirmRegistID")(html_u8, static_cast<int32_t>(type)));
+    }
+    /*!
+     *  @brief  ʂ؂o
+     *  @param[in]  html_u8     sresponse(html/UTF-8)
+     *  @param[out] rcv_order   i[
+     *  @retval true    tꂽ
+     */
+    bool ResponseStockOrderExec(const std::string& html_u8, RcvResponseStockOrder& rcv_order)
+    {
+        if (m_b_native_html_parser) {
+            return html_parser_sbi::ResponseStockOrderExec(html_u8, rcv_order);
+        }
+        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
+        std::lock_guard<std::recursive_mutex> lock(m_mtx);
+        const boost::python::tuple t
+            = boost::python::extract<boost::python::tuple>(m_python.attr("responseStockOrderExec")(html_u8));
+        return ToRcvResponseStockOrderFrom_responseStockOrderExec(t, rcv_order);
+    }
+
+    /*!
+     *  @brief  ʂv[𓾂
+     *  @param  type    
+     */
+    static HttpClientPool::eLane GetOrderLane(eOrderType type)
+    {
+        if (type == ORDER_CORRECT || type == ORDER_CANCEL) {
+            return HttpClientPool::LANE_CONTROL;
+        }
+        return HttpClientPool::LANE_ORDER;
+    }
+
+    /*!
+     *  @brief  vɎst
+     *  @param  task        v^XN
+     *  @param  callback    R[obN
+     *  @note   ʐMs/؂łcallbackĂŒ҂
+     */
+    static void CatchOrderFailure(const pplx::task<void>& task, const OrderCallback& callback)
+    {
+        task.then([callback](pplx::task<void> prev)
+        {
+            try {
+                prev.wait();
+            } catch (...) {
+                callback(false, RcvResponseStockOrder(), std::wstring());
+            }
+        });
+    }
+
     /*!
      *  @brief  ėp
      *  @param  order           
@@ -78,9 +244,8 @@ private:
             return;
         }
         //  regist_id擾
-        web::http::client::http_client http_client(input_url);
-        http_client.request(request).then([this, input_url, order, pwd, callback,
-                                           pre_confirm, pre_execute](web::http::http_response response)
+        CatchOrderFailure(m_http_pool.Request(input_url, request, GetOrderLane(order.m_type)).then([this, input_url, order, pwd, callback,
+                                                                                                    pre_confirm, pre_execute](web::http::http_response response)
         {
             m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), input_url);
@@ -91,73 +256,196 @@ private:
                                                                     input_url, order, pwd, callback,
                                                                     pre_confirm, pre_execute](size_t bytesRead)
             {
-                // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                std::lock_guard<std::recursive_mutex> lock(m_mtx);
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_INPUT);
+                const int64_t regist_id = GetStockOrderRegistID(inStringBuffer.collection(), order.m_type);
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_INPUT_PARSE);
+                if (regist_id < 0) {
+                    callback(false, RcvResponseStockOrder(), date_str);
+                    return;
+                }
+
+                StockOrderConfirmExecute(order, pwd, callback, regist_id, input_url, pre_confirm, pre_execute);
+            });
+        }), callback);
+    }
 
-                const int32_t i_order_type = static_cast<int32_t>(order.m_type);
-                const int64_t regist_id
-                    = boost::python::extract<int64_t>(m_python.attr("getStockOrderRegistID")(inStringBuffer.collection(), i_order_type));
+    /*!
+     *  @brief  ėp(mF`s)
+     *  @param  order           
+     *  @param  pwd
+     *  @param  callback        R[obN
+     *  @param  regist_id       j[NID(͂瓾)
+     *  @param  input_url       URL
+     *  @param  pre_confirm     mFO
+     *  @param  pre_execute     sO
+     *  @note   ǂݒ͂gꍇ͒ڌĂ
+     */
+    void StockOrderConfirmExecute(const StockOrder& order,
+                                  const std::wstring& pwd,
+                                  const OrderCallback& callback,
+                                  int64_t regist_id,
+                                  const std::wstring& input_url,
+                                  const PreOrderConfirm& pre_confirm,
+                                  const PreOrderExecute& pre_execute)
+    {
+        // mF regist_id擾
+        web::http::http_request request(web::http::methods::POST);
+        std::wstring cf_url(std::move(pre_confirm(order, pwd, regist_id, input_url, request)));
+        //
+        CatchOrderFailure(m_http_pool.Request(cf_url, request, GetOrderLane(order.m_type)).then([this, cf_url, order, callback,
+                                                                                                 pre_execute](web::http::http_response response)
+        {
+            m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
+            m_cookies_gr.Set(response.headers(), cf_url);
+            utility::string_t date_str(response.headers().date());
+            concurrency::streams::istream bodyStream = response.body();
+            concurrency::streams::container_buffer<std::string> inStringBuffer;
+            return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str,
+                                                                     cf_url, order, callback,
+                                                                     pre_execute](size_t bytesRead)
+            {
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_CONFIRM);
+                const int64_t regist_id = GetStockOrderConfirmRegistID(inStringBuffer.collection(), order.m_type);
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_CONFIRM_PARSE);
                 if (regist_id < 0) {
                     callback(false, RcvResponseStockOrder(), date_str);
                     return;
                 }
 
-                // mF regist_id擾
+                // s
                 web::http::http_request request(web::http::methods::POST);
-                std::wstring cf_url(std::move(pre_confirm(order, pwd, regist_id, input_url, request)));
+                std::wstring ex_url(std::move(pre_execute(order, regist_id, cf_url, request)));
                 //
-                web::http::client::http_client http_client(cf_url);
-                http_client.request(request).then([this, cf_url, order, callback,
-                                                   pre_execute](web::http::http_response response)
+                CatchOrderFailure(m_http_pool.Request(ex_url, request, GetOrderLane(order.m_type)).then([this, ex_url, callback](web::http::http_response response)
                 {
                     m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
-                    m_cookies_gr.Set(response.headers(), cf_url);
+                    m_cookies_gr.Set(response.headers(), ex_url);
                     utility::string_t date_str(response.headers().date());
                     concurrency::streams::istream bodyStream = response.body();
                     concurrency::streams::container_buffer<std::string> inStringBuffer;
-                    return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str,
-                                                                             cf_url, order, callback,
-                                                                             pre_execute](size_t bytesRead)
+                    return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str, callback](size_t bytesRead)
                     {
-                        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                        std::lock_guard<std::recursive_mutex> lock(m_mtx);
-
-                        const int32_t i_order_type = static_cast<int32_t>(order.m_type);
-                        const int64_t regist_id
-                            = boost::python::extract<int64_t>(m_python.attr("getStockOrderConfirmRegistID")(inStringBuffer.collection(), i_order_type));
-                        if (regist_id < 0) {
-                            callback(false, RcvResponseStockOrder(), date_str);
-                            return;
-                        }
-
-                        // s
-                        web::http::http_request request(web::http::methods::POST);
-                        std::wstring ex_url(std::move(pre_execute(order, regist_id, cf_url, request)));
-                        //
-                        web::http::client::http_client http_client(ex_url);
-                        http_client.request(request).then([this, ex_url, callback](web::http::http_response response)
-                        {
-                            m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
-                            m_cookies_gr.Set(response.headers(), ex_url);
-                            utility::string_t date_str(response.headers().date());
-                            concurrency::streams::istream bodyStream = response.body();
-                            concurrency::streams::container_buffer<std::string> inStringBuffer;
-                            return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str, callback](size_t bytesRead)
-                            {
-                                // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                                std::lock_guard<std::recursive_mutex> lock(m_mtx);
-                                //
-                                const boost::python::tuple t
-                                    = boost::python::extract<boost::python::tuple>(m_python.attr("responseStockOrderExec")(inStringBuffer.collection()));
-                                RcvResponseStockOrder rcv_order;
-                                const bool b_result = ToRcvResponseStockOrderFrom_responseStockOrderExec(t, rcv_order);
-                                callback(b_result, rcv_order, date_str);
-                            });
-                        });
+                        StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_EXECUTE);
+                        RcvResponseStockOrder rcv_order;
+                        const bool b_result = ResponseStockOrderExec(inStringBuffer.collection(), rcv_order);
+                        StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_EXECUTE_PARSE);
+                        callback(b_result, rcv_order, date_str);
                     });
-                });
+                }), callback);
             });
-        });
+        }), callback);
+    }
+
+    /*!
+     *  @brief  ǂ݃L[
+     *  @param  order   
+     *  @note   (R[h, , MptO, )ň
+     */
+    static uint64_t ToPrefetchKey(const StockOrder& order)
+    {
+        return (static_cast<uint64_t>(order.GetCode()) << 32) |
+               (static_cast<uint64_t>(order.m_type) << 16) |
+               (static_cast<uint64_t>(order.m_b_leverage ?1 :0) << 8) |
+               static_cast<uint64_t>(order.m_investments);
+    }
+    /*!
+     *  @brief  ǂݒ͂o
+     *  @param[in]  order   
+     *  @param[out] dst     i[
+     *  @retval true    LȐǂ݂
+     *  @note   oǂ݂Ɗ؂̐ǂ݂͔j
+     */
+    bool TakePrefetchedOrderInput(const StockOrder& order, PrefetchedOrderInput& dst)
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mtx);
+        const auto it = m_prefetch_input.find(ToPrefetchKey(order));
+        if (it == m_prefetch_input.end()) {
+            return false;
+        }
+        const PrefetchedOrderInput& pf_input(it->second);
+        if (pf_input.m_regist_id < 0) {
+            return false; // 擾
+        }
+        const int64_t tick = utility_datetime::GetTickCountGeneral();
+        const bool b_valid = (tick - pf_input.m_tick) < m_prefetch_expire_ms;
+        if (b_valid) {
+            dst = std::move(it->second);
+        }
+        m_prefetch_input.erase(it);
+        return b_valid;
+    }
+
+    /*!
+     *  @brief  vJn
+     *  @param  type    v
+     *  @return vʂԍ(0ȂOv̉҂Ȃ̂ŗvȂ)
+     *  @note   ҂𒴂ĂOv̉͒߂ėv
+     */
+    uint64_t BeginPolling(ePollingType type)
+    {
+        const int64_t tick = utility_datetime::GetTickCountGeneral();
+        std::lock_guard<std::mutex> lock(m_polling_mtx);
+        PollingState& st(m_polling[type]);
+        if (st.m_b_inflight && (tick - st.m_request_tick) < m_polling_inflight_limit_ms) {
+            st.m_skip++;
+            return 0;
+        }
+        st.m_b_inflight = true;
+        st.m_request_tick = tick;
+        st.m_request++;
+        return ++st.m_issued_seq;
+    }
+    /*!
+     *  @brief  vfJn
+     *  @param  type    v
+     *  @param  seq     vʂԍ
+     *  @retval true    fėǂ
+     *  @retval false   V𔽉fς(̂Ă)
+     *  @note   m_polling_parse_mtx[type]bN܂܌ĂсAʂnI܂ŗȂ
+     *  @note   (̓Xbh/httpXbhŉ͂ꍇɌÂʂォ͂Ȃ悤)
+     */
+    bool ApplyPolling(ePollingType type, uint64_t seq)
+    {
+        std::lock_guard<std::mutex> lock(m_polling_mtx);
+        PollingState& st(m_polling[type]);
+        if (seq == st.m_issued_seq) {
+            st.m_b_inflight = false;
+        }
+        if (seq <= st.m_applied_seq) {
+            st.m_stale++;
+            return false;
+        }
+        st.m_applied_seq = seq;
+        return true;
+    }
+    /*!
+     *  @brief  ͗Oo
+     *  @param  e   ͏O
+     *  @note   pythonOȂG[eo͂(o͂pythonĜŃbNĂ)
+     */
+    void OutputParseError(const std::exception_ptr& e)
+    {
+        try {
+            std::rethrow_exception(e);
+        } catch (boost::python::error_already_set& py_e) {
+            std::lock_guard<std::recursive_mutex> lock(m_mtx);
+            utility_python::OutputPythonError(py_e);
+        } catch (...) {
+            // pythonȊO(͌ʂ̕ϊsȂ)͎s̒ʒm
+        }
+    }
+    /*!
+     *  @brief  vs
+     *  @param  type    v
+     *  @param  seq     vʂԍ
+     */
+    void FailPolling(ePollingType type, uint64_t seq)
+    {
+        std::lock_guard<std::mutex> lock(m_polling_mtx);
+        PollingState& st(m_polling[type]);
+        if (seq == st.m_issued_seq) {
+            st.m_b_inflight = false;
+        }
     }
 
 public:
@@ -168,13 +456,32 @@ public:
     /* html͗ppythonuWFNg */
     : m_python(std::move(utility_python::PreparePythonScript(Environment::GetPythonConfig(), "html_parser_sbi.py")))
     , m_cookies_gr()
+    , m_http_pool(utility_datetime::ToMiliSecondsFromSecond(script_mng.GetHttpRequestTimeoutSecond()),
+                  script_mng.GetHttpHedgePercentile(),
+                  script_mng.GetHttpHedgeMinMilliSecond(),
+                  script_mng.GetHttpRequestPerSecond())
     , m_last_access_tick_mb(0)
     , m_last_access_tick_pc(0)
     , m_max_code_register(script_mng.GetMaxMonitoringCodeRegister())
     , m_use_pf_number_monitoring(script_mng.GetUsePortfolioNumberForMonitoring())
     , m_pf_indicate_monitoring(script_mng.GetPortfolioIndicateForMonitoring())
     , m_pf_indicate_owned(script_mng.GetPortfolioIndicateForOwned())
+    , m_prefetch_expire_ms(
+        utility_datetime::ToMiliSecondsFromSecond(script_mng.GetOrderPrefetchExpireSecond()))
+    , m_b_native_html_parser(script_mng.GetUseNativeHtmlParser() != 0)
+    , m_prefetch_input()
+    , m_body_hash_mtx()
+    , m_body_hash()
+    , m_polling_inflight_limit_ms(
+        utility_datetime::ToMiliSecondsFromSecond(script_mng.GetPollingInflightLimitSecond()))
+    , m_polling_mtx()
+    , m_polling()
+    , m_polling_parse_mtx()
+    , m_parse_worker(script_mng.GetHtmlParserThreads(), script_mng.GetHtmlParserQueueCapacity())
     {
+#if defined(DEBUG_BENCHMARK_HTML_PARSER) && (DEBUG_BENCHMARK_HTML_PARSER != 0)
+        BenchmarkPortfolioPC("portfolio_get.html", 100);
+#endif/* DEBUG_BENCHMARK_HTML_PARSER */
     }
 
     /*!
@@ -186,8 +493,7 @@ public:
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderSimple(request);
         // mobileTCg_
-        web::http::client::http_client http_client(URL_BK_BASE);
-        http_client.request(request).then([callback](web::http::http_response response)
+        m_http_pool.Request(URL_BK_BASE, request, HttpClientPool::LANE_GENERAL).then([callback](web::http::http_response response)
         {
             callback(response.headers().date());
         });
@@ -207,8 +513,7 @@ public:
         utility_http::SetHttpCommonHeaderSimple(request);
         BuildLoginFormData(uid, pwd, request);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, uid, pwd, url, callback](web::http::http_response response)
+        m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, uid, pwd, url, callback](web::http::http_response response)
         {
             m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
@@ -237,8 +542,7 @@ public:
                 utility_http::SetHttpCommonHeaderSimple(request);
                 BuildLoginPCFormData(uid, pwd, request);
                 //
-                web::http::client::http_client http_client(url);
-                http_client.request(request).then([this, url, callback](web::http::http_response response)
+                m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, url, callback](web::http::http_response response)
                 {
                     m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
                     m_cookies_gr.Set(response.headers(), url);
@@ -274,14 +578,18 @@ public:
                                 eStockInvestmentsType investments_type,
                                 const RegisterMonitoringCodeCallback& callback)
     {
+        {
+            // 󂯎葤Ď̂ŁẢif[^͓eł͂
+            std::lock_guard<std::mutex> lock(m_body_hash_mtx);
+            m_body_hash.clear();
+        }
         // o^mF(regist_id擾)
         const std::wstring url(std::move(std::wstring(URL_BK_BASE) + URL_BK_STOCKENTRYCONFIRM));
         web::http::http_request request(web::http::methods::POST);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(), request);
         BuildDummyMonitoringCodeFormData(m_use_pf_number_monitoring, m_max_code_register, request);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this,
+        m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this,
                                            monitoring_code,
                                            investments_type,
                                            url,
@@ -309,8 +617,7 @@ public:
                 utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(URL_BK_BASE)+URL_BK_STOCKENTRYCONFIRM, request);
                 BuildMonitoringCodeFormData(m_use_pf_number_monitoring, m_max_code_register, monitoring_code, investments_type, regist_id, request);
                 //
-                web::http::client::http_client http_client(url);
-                http_client.request(request).then([this, url, callback](web::http::http_response response)
+                m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, url, callback](web::http::http_response response)
                 {
                     m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
                     m_cookies_gr.Set(response.headers(), url);
@@ -353,8 +660,7 @@ public:
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_MAIN_SBI_MAIN, request);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, callback](web::http::http_response response)
+        m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, callback](web::http::http_response response)
         {
             m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), URL_MAIN_SBI_TRANS_PF_CHECK); // site0Ɉړc
@@ -375,8 +681,7 @@ public:
                 utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_MAIN_SBI_TRANS_PF_CHECK, request);
                 BuildTransmitMonitoringCodeFormData(request);
                 //
-                web::http::client::http_client http_client(url);
-                http_client.request(request).then([this, url, callback](web::http::http_response response)
+                m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, url, callback](web::http::http_response response)
                 {
                     m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
                     m_cookies_gr.Set(response.headers(), url);
@@ -404,8 +709,7 @@ public:
             std::move(BuildPortfolioURL(PORTFOLIO_ID_OWNED, m_pf_indicate_owned)));
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_MAIN_SBI_MAIN, request);
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, callback](web::http::http_response response)
+        m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, url, callback](web::http::http_response response)
         {
             m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
@@ -454,7 +758,7 @@ public:
                         StockPosition t_pos;
                         t_pos.m_code = std::move(StockCode(extract<uint32_t>(elem[0])));
                         t_pos.m_date
-                            = std::move(garnet::YYMMDD::Create(extract<std::string>(elem[3])));
+                            = std::move(trade_datetime::ToYYMMDDFromString(extract<std::string>(elem[3])));
                         t_pos.m_value = extract<float64>(elem[4]);
                         t_pos.m_number = extract<int32_t>(elem[1]);
                         t_pos.m_b_sell = extract<bool>(elem[2]);
@@ -472,126 +776,287 @@ public:
     /*!
      *  @brief  Ďif[^擾
      *  @param  callback    R[obN
+     *  @note   {̂O͂̂ƓȂ͂Â܂ܐԂ
+     *  @note   Ov̉҂ȂvȂ(callbackĂ΂Ȃ)
+     *  @note   V𔽉fς݂Ȃ̂Ă(callbackĂ΂Ȃ)
      */
     void UpdateValueData(const UpdateValueDataCallback& callback)
     {
+        const uint64_t seq = BeginPolling(POLLING_VALUEDATA);
+        if (seq == 0) {
+            return;
+        }
         const std::wstring url(
             std::move(BuildPortfolioURL(PORTFOLIO_ID_USER_TOP+m_use_pf_number_monitoring,
                                         m_pf_indicate_monitoring)));
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_MAIN_SBI_MAIN, request);
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, callback](web::http::http_response response)
+        m_http_pool.RequestHedged(url, request, HttpClientPool::LANE_VALUEDATA).then([this, url, seq, callback](web::http::http_response response)
         {
             m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
             const utility::string_t date_str(response.headers().date());
             concurrency::streams::istream bodyStream = response.body();
             concurrency::streams::container_buffer<std::string> inStringBuffer;
-            return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str, callback](size_t bytesRead)
+            return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, url, seq, date_str, callback](size_t bytesRead)
             {
-                // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                std::lock_guard<std::recursive_mutex> lock(m_mtx);
-
-                using boost::python::list;
-                using boost::python::extract;
-                //
-                std::vector<RcvStockValueData> rcv_valuedata;
-                const std::string& html_sjis = inStringBuffer.collection();
-                const list l = extract<list>(m_python.attr("getPortfolioPC")(html_sjis));
-                const auto len = boost::python::len(l);
-                rcv_valuedata.reserve(len);
-                for (auto inx = 0; inx < len; inx++) {
-                    auto elem = l[inx];
-                    RcvStockValueData rcv_vunit;
-                    rcv_vunit.m_code = extract<uint32_t>(elem[0]);
-                    rcv_vunit.m_value = extract<float64>(elem[1]);
-                    rcv_vunit.m_open = extract<float64>(elem[2]);
-                    rcv_vunit.m_high = extract<float64>(elem[3]);
-                    rcv_vunit.m_low = extract<float64>(elem[4]);
-                    rcv_vunit.m_close = extract<float64>(elem[5]);
-                    rcv_vunit.m_volume = extract<int64_t>(elem[6]);
-                    rcv_valuedata.push_back(rcv_vunit);
-                }
-                const bool b_success = !rcv_valuedata.empty();
-                callback(b_success, rcv_valuedata, date_str);
+                // ͂͐pXbhōs({̂container_bufferƓn̂ŃRs[Ȃ)
+                m_parse_worker.Post([this, inStringBuffer, url, seq, date_str, callback]()
+                {
+                    // ʂԍmF`callback(Mʓ)𓯎̉Əd˂Ȃ
+                    std::lock_guard<std::mutex> parse_lock(m_polling_parse_mtx[POLLING_VALUEDATA]);
+                    if (!ApplyPolling(POLLING_VALUEDATA, seq)) {
+                        return; // ǂzꂽ(Â)
+                    }
+                    std::vector<RcvStockValueData> rcv_valuedata;
+                    const std::string& html_sjis = inStringBuffer.collection();
+                    const uint64_t body_hash = trade_utility::hash_bytes(html_sjis.data(), html_sjis.size());
+                    if (IsSameBody(url, body_hash)) {
+                        // lȂ  ͂if[^XVsv
+                        m_parse_worker.CountSkip();
+                        callback(true, rcv_valuedata, date_str);
+                        return;
+                    }
+                    if (m_b_native_html_parser) {
+                        // nativełpythongȂ̂ŃbNsv
+                        html_parser_sbi::GetPortfolioPC(html_sjis, rcv_valuedata);
+                    } else {
+                        GetPortfolioPC_Python(html_sjis, rcv_valuedata);
+                    }
+                    const bool b_success = !rcv_valuedata.empty();
+                    if (b_success) {
+                        SetBodyHash(url, body_hash);
+                    }
+                    callback(b_success, rcv_valuedata, date_str);
+                },
+                [this, seq, date_str, callback](const std::exception_ptr& e)
+                {
+                    OutputParseError(e);
+                    FailPolling(POLLING_VALUEDATA, seq);
+                    callback(false, std::vector<RcvStockValueData>(), date_str);
+                });
             });
+        }).then([this, seq](pplx::task<void> prev)
+        {
+            try {
+                prev.wait();
+            } catch (...) {
+                FailPolling(POLLING_VALUEDATA, seq); // ʐMs(̒v~߂Ȃ)
+            }
         });
     }
 
+    /*!
+     *  @brief  {̂O͂̂Ɠ
+     *  @param  url         vURL
+     *  @param  body_hash   {̂̃nbV
+     */
+    bool IsSameBody(const std::wstring& url, uint64_t body_hash)
+    {
+        std::lock_guard<std::mutex> lock(m_body_hash_mtx);
+        const auto it = m_body_hash.find(url);
+        return it != m_body_hash.end() && it->second == body_hash;
+    }
+    /*!
+     *  @brief  ͂{̂̃nbVL^
+     *  @param  url         vURL
+     *  @param  body_hash   {̂̃nbV
+     */
+    void SetBodyHash(const std::wstring& url, uint64_t body_hash)
+    {
+        std::lock_guard<std::mutex> lock(m_body_hash_mtx);
+        m_body_hash[url] = body_hash;
+    }
+
+    /*!
+     *  @brief  |[gtHI؂o(python)
+     *  @param[in]  html_sjis   |[gtHI܂response(html/Shift-JIS)
+     *  @param[out] dst         i[
+     */
+    void GetPortfolioPC_Python(const std::string& html_sjis, std::vector<RcvStockValueData>& dst)
+    {
+        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
+        std::lock_guard<std::recursive_mutex> lock(m_mtx);
+
+        using boost::python::list;
+        using boost::python::extract;
+        //
+        const list l = extract<list>(m_python.attr("getPortfolioPC")(html_sjis));
+        const auto len = boost::python::len(l);
+        dst.reserve(len);
+        for (auto inx = 0; inx < len; inx++) {
+            auto elem = l[inx];
+            RcvStockValueData rcv_vunit;
+            rcv_vunit.m_code = extract<uint32_t>(elem[0]);
+            rcv_vunit.m_value = extract<float64>(elem[1]);
+            rcv_vunit.m_open = extract<float64>(elem[2]);
+            rcv_vunit.m_high = extract<float64>(elem[3]);
+            rcv_vunit.m_low = extract<float64>(elem[4]);
+            rcv_vunit.m_close = extract<float64>(elem[5]);
+            rcv_vunit.m_volume = extract<int64_t>(elem[6]);
+            dst.push_back(rcv_vunit);
+        }
+    }
+
+#if defined(DEBUG_BENCHMARK_HTML_PARSER) && (DEBUG_BENCHMARK_HTML_PARSER != 0)
+    /*!
+     *  @brief  |[gtHI؂ox`}[N(python/native)
+     *  @param  filename    L^ς݃|[gtHIhtml(Shift-JIS)
+     *  @param  loop        JԂ
+     *  @note   1񂠂̏vԂƌʂ̈vstd::wcout֏o
+     */
+    void BenchmarkPortfolioPC(const std::string& filename, int32_t loop)
+    {
+        std::ifstream ifs(filename.c_str(), std::ios::binary);
+        if (!ifs) {
+            return;
+        }
+        const std::string html_sjis((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        //
+        typedef std::chrono::steady_clock bm_clock;
+        std::vector<RcvStockValueData> py_data;
+        std::vector<RcvStockValueData> nt_data;
+        const auto py_begin = bm_clock::now();
+        for (int32_t inx = 0; inx < loop; inx++) {
+            py_data.clear();
+            GetPortfolioPC_Python(html_sjis, py_data);
+        }
+        const auto nt_begin = bm_clock::now();
+        for (int32_t inx = 0; inx < loop; inx++) {
+            nt_data.clear();
+            html_parser_sbi::GetPortfolioPC(html_sjis, nt_data);
+        }
+        const auto nt_end = bm_clock::now();
+        //
+        bool b_match = py_data.size() == nt_data.size();
+        for (size_t inx = 0; b_match && inx < py_data.size(); inx++) {
+            const RcvStockValueData& py(py_data[inx]);
+            const RcvStockValueData& nt(nt_data[inx]);
+            b_match = py.m_code == nt.m_code &&
+                      trade_utility::same_value(py.m_value, nt.m_value) &&
+                      trade_utility::same_value(py.m_open, nt.m_open) &&
+                      trade_utility::same_value(py.m_high, nt.m_high) &&
+                      trade_utility::same_value(py.m_low, nt.m_low) &&
+                      trade_utility::same_value(py.m_close, nt.m_close) &&
+                      py.m_volume == nt.m_volume;
+        }
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        const int64_t py_us = duration_cast<microseconds>(nt_begin - py_begin).count();
+        const int64_t nt_us = duration_cast<microseconds>(nt_end - nt_begin).count();
+        std::wcout << L"[benchmark] getPortfolioPC brand=" << nt_data.size()
+                   << L" python=" << py_us/loop << L"us"
+                   << L" native=" << nt_us/loop << L"us"
+                   << L" match=" << ((b_match) ?L"true" :L"false") << std::endl;
+    }
+#endif/* DEBUG_BENCHMARK_HTML_PARSER */
+
     /*!
      *  @brief  蒍擾
      *  @param  callback    R[obN
+     *  @note   Ov̉҂ȂvȂ/V𔽉fς݂Ȃ̂Ă(callbackĂ΂Ȃ)
      */
     void UpdateExecuteInfo(const UpdateStockExecInfoCallback& callback)
     {
+        const uint64_t seq = BeginPolling(POLLING_EXECINFO);
+        if (seq == 0) {
+            return;
+        }
         const std::wstring url(
             std::move(std::wstring(URL_MAIN_SBI_MAIN) + URL_MAIN_SBI_ORDER_LIST));
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_MAIN_SBI_MAIN, request);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, callback](web::http::http_response response)
+        m_http_pool.RequestHedged(url, request, HttpClientPool::LANE_EXECINFO).then([this, url, seq, callback](web::http::http_response response)
         {
             garnet::sTime date_tm;
-            const utility::string_t date_str(std::move(response.headers().date()));
-            auto ptime = std::move(garnet::utility_datetime::ToLocalTimeFromRFC1123(date_str));
-            garnet::utility_datetime::ToTimeFromBoostPosixTime(ptime, date_tm);
+            trade_datetime::ToLocalTimeFromRFC1123(response.headers().date(), date_tm);
             //
             m_last_access_tick_pc = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
             concurrency::streams::istream bodyStream = response.body();
             concurrency::streams::container_buffer<std::string> inStringBuffer;
             return bodyStream.read_to_delim(inStringBuffer, 0).then([this,
-                                                                     inStringBuffer, date_tm,
+                                                                     inStringBuffer, date_tm, seq,
                                                                      callback](size_t bytesRead)
             {
-                // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                std::lock_guard<std::recursive_mutex> lock(m_mtx);
+                // ͂͐pXbhōs({̂container_bufferƓn̂ŃRs[Ȃ)
+                m_parse_worker.Post([this, inStringBuffer, date_tm, seq, callback]()
+                {
+                    // ʂԍmF`callback(Mʓ)𓯎̉Əd˂Ȃ
+                    std::lock_guard<std::mutex> parse_lock(m_polling_parse_mtx[POLLING_EXECINFO]);
+                    if (!ApplyPolling(POLLING_EXECINFO, seq)) {
+                        return; // ǂzꂽ(Â)
+                    }
+                    const std::string& html_sjis = inStringBuffer.collection();
+                    if (m_b_native_html_parser) {
+                        // nativełpythongȂ̂ŃbNsv
+                        // ω̂Ȃ̓ǂݔ΂͎󂯎葤(Xbh)ōs
+                        std::vector<StockExecInfoAtOrder> rcv_data;
+                        const bool b_result = html_parser_sbi::GetTodayExecInfo(html_sjis, date_tm, rcv_data);
+                        callback(b_result, rcv_data);
+                        return;
+                    }
+                    // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
+                    std::lock_guard<std::recursive_mutex> lock(m_mtx);
 
-                using boost::python::tuple;
-                using boost::python::list;
-                using boost::python::extract;
-                //
-                const std::string& html_sjis = inStringBuffer.collection();
-                const tuple t = extract<tuple>(m_python.attr("getTodayExecInfo")(html_sjis));
-                const bool b_result = extract<bool>(t[0]);
-                if (!b_result) {
-                    callback(false, std::vector<StockExecInfoAtOrder>());
-                    return;
-                }
-                const list l = extract<list>(t[1]);
-                const auto len = boost::python::len(l);
-                garnet::sTime exe_tm;
-                std::vector<StockExecInfoAtOrder> rcv_data;
-                rcv_data.reserve(len);
-                for (auto inx = 0; inx < len; inx++) {
-                    auto elem = l[inx];
-                    StockExecInfoAtOrder exe_info;
-                    exe_info.m_user_order_id = extract<int32_t>(elem[0]);
-                    const int32_t i_odtype = extract<int32_t>(elem[1]);
-                    exe_info.m_type = static_cast<eOrderType>(i_odtype);
-                    const std::string investments_str = std::move(extract<std::string>(elem[2]));
-                    exe_info.m_investments = GetStockInvestmentsTypeFromSbiCode(investments_str);
-                    exe_info.m_code = extract<uint32_t>(elem[3]);
-                    exe_info.m_b_leverage = extract<bool>(elem[4]);
-                    exe_info.m_b_complete = extract<bool>(elem[5]);
-                    const list exe_list = extract<list>(elem[6]);
-                    const auto len_exe = boost::python::len(exe_list);
-                    exe_info.m_exec.reserve(len_exe);
-                    for (auto exe_inx = 0; exe_inx < len_exe; exe_inx++) {
-                        auto exe_elem = exe_list[exe_inx];
-                        const std::string datetime = std::move(extract<std::string>(exe_elem[0]));
-                        const int32_t number = extract<int32_t>(exe_elem[1]);
-                        const float64 value = extract<float64>(exe_elem[2]);
-                        utility_datetime::ToTimeFromString(datetime, "%m/%d %H:%M:%S", exe_tm);
-                        exe_tm.tm_year = date_tm.tm_year;
-                        exe_info.m_exec.emplace_back(exe_tm, number, value);
+                    using boost::python::tuple;
+                    using boost::python::list;
+                    using boost::python::extract;
+                    //
+                    const tuple t = extract<tuple>(m_python.attr("getTodayExecInfo")(html_sjis));
+                    const bool b_result = extract<bool>(t[0]);
+                    if (!b_result) {
+                        callback(false, std::vector<StockExecInfoAtOrder>());
+                        return;
                     }
-                    rcv_data.emplace_back(std::move(exe_info));
-                }
-                callback(true, rcv_data);
+                    const list l = extract<list>(t[1]);
+                    const auto len = boost::python::len(l);
+                    garnet::sTime exe_tm;
+                    memset(reinterpret_cast<void*>(&exe_tm), 0, sizeof(exe_tm));
+                    std::vector<StockExecInfoAtOrder> rcv_data;
+                    rcv_data.reserve(len);
+                    for (auto inx = 0; inx < len; inx++) {
+                        auto elem = l[inx];
+                        StockExecInfoAtOrder exe_info;
+                        exe_info.m_user_order_id = extract<int32_t>(elem[0]);
+                        const int32_t i_odtype = extract<int32_t>(elem[1]);
+                        exe_info.m_type = static_cast<eOrderType>(i_odtype);
+                        const std::string investments_str = std::move(extract<std::string>(elem[2]));
+                        exe_info.m_investments = GetStockInvestmentsTypeFromSbiCode(investments_str);
+                        exe_info.m_code = extract<uint32_t>(elem[3]);
+                        exe_info.m_b_leverage = extract<bool>(elem[4]);
+                        exe_info.m_b_complete = extract<bool>(elem[5]);
+                        const list exe_list = extract<list>(elem[6]);
+                        const auto len_exe = boost::python::len(exe_list);
+                        exe_info.m_exec.reserve(len_exe);
+                        for (auto exe_inx = 0; exe_inx < len_exe; exe_inx++) {
+                            auto exe_elem = exe_list[exe_inx];
+                            const std::string datetime = std::move(extract<std::string>(exe_elem[0]));
+                            const int32_t number = extract<int32_t>(exe_elem[1]);
+                            const float64 value = extract<float64>(exe_elem[2]);
+                            trade_datetime::ToTimeFromExecDateTime(datetime, exe_tm);
+                            exe_tm.tm_year = date_tm.tm_year;
+                            exe_info.m_exec.emplace_back(exe_tm, number, value);
+                        }
+                        rcv_data.emplace_back(std::move(exe_info));
+                    }
+                    callback(true, rcv_data);
+                },
+                [this, seq, callback](const std::exception_ptr& e)
+                {
+                    OutputParseError(e);
+                    FailPolling(POLLING_EXECINFO, seq);
+                    callback(false, std::vector<StockExecInfoAtOrder>());
+                });
             });
+        }).then([this, seq](pplx::task<void> prev)
+        {
+            try {
+                prev.wait();
+            } catch (...) {
+                FailPolling(POLLING_EXECINFO, seq); // ʐMs(̒v~߂Ȃ)
+            }
         });
     }
 
@@ -605,8 +1070,7 @@ public:
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, URL_BK_BASE, request);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, callback](web::http::http_response response)
+        m_http_pool.Request(url, request, HttpClientPool::LANE_KEEPALIVE).then([this, url, callback](web::http::http_response response)
         {
             const int64_t rcv_tick = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
@@ -640,9 +1104,7 @@ public:
     void BuySellOrder(const StockOrder& order, const std::wstring& pwd, const OrderCallback& callback)
     {
         //  regist_id擾
-        std::wstring url(std::move(BuildOrderURL(order.m_b_leverage, order.m_type, OSTEP_INPUT)));
-        utility_http::AddItemToURL(PARAM_NAME_ORDER_STOCK_CODE, std::to_wstring(order.m_code.GetCode()), url);
-        utility_http::AddItemToURL(PARAM_NAME_ORDER_INVESTIMENTS, GetSbiInvestimentsCode(order.m_investments), url);
+        std::wstring url(std::move(BuildFreshOrderInputURL(order)));
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(), request);
 
@@ -670,9 +1132,154 @@ public:
             return ex_url;
         };
 
+        // ǂݍς݂Ȃ璍͂ȗ
+        if (order.IsValid()) {
+            PrefetchedOrderInput pf_input;
+            if (TakePrefetchedOrderInput(order, pf_input)) {
+                // ǂ݂͎o_Ŏ茳̂̂Ȃ̂ŃbNsv(python͂̏I҂Ȃ)
+                if (pf_input.m_number != order.m_number || pf_input.m_base_form.empty()) {
+                    StockOrderConfirmExecute(order, pwd, callback,
+                                             pf_input.m_regist_id, pf_input.m_input_url,
+                                             pre_confirm, pre_execute);
+                    return;
+                }
+                // \zςform dataɉi/passt邾ő
+                const std::wstring cf_url(std::move(pf_input.m_confirm_url));
+                const std::wstring ex_url(std::move(pf_input.m_execute_url));
+                const std::wstring base_form(std::move(pf_input.m_base_form));
+                const auto spc_confirm = [this, cf_url, base_form](const StockOrder& order,
+                                                                   const std::wstring& pass,
+                                                                   int64_t regist_id,
+                                                                   const std::wstring& input_url,
+                                                                   web::http::http_request& request)->std::wstring
+                {
+                    utility_http::SetHttpCommonHeaderKeepAlive(cf_url, m_cookies_gr, input_url, request);
+                    BuildFreshOrderFormDataFromBase(base_form, order, pass, regist_id, request); // ͂regist_id
+                    return cf_url;
+                };
+                const auto spc_execute = [this, ex_url, base_form](const StockOrder& order,
+                                                                   int64_t regist_id,
+                                                                   const std::wstring& cf_url,
+                                                                   web::http::http_request& request)->std::wstring
+                {
+                    utility_http::SetHttpCommonHeaderKeepAlive(ex_url, m_cookies_gr, cf_url, request);
+                    // spasssv/regist_id͒mFœ
+                    BuildFreshOrderFormDataFromBase(base_form, order, std::wstring(), regist_id, request);
+                    return ex_url;
+                };
+                StockOrderConfirmExecute(order, pwd, callback,
+                                         pf_input.m_regist_id, pf_input.m_input_url,
+                                         spc_confirm, spc_execute);
+                return;
+            }
+        }
         StockOrderExecute(order, pwd, callback, url, pre_confirm, pre_execute, request);
     }
 
+    /*!
+     *  @brief  ͐ǂ
+     *  @param  order   (i͖ŗǂ)
+     *  @note   (EMpVK)̂
+     *  @note   擾ς݂łLԂ̔߂ĂΎ蒼
+     *  @note   regist_id擾AmF/sURLform datai/pass/regist_idȊO\zĂ
+     */
+    void PrefetchOrderInput(const StockOrder& order)
+    {
+        if (order.m_type != ORDER_BUY && order.m_type != ORDER_SELL) {
+            return;
+        }
+        const uint64_t key = ToPrefetchKey(order);
+        const std::wstring url(std::move(BuildFreshOrderInputURL(order)));
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_mtx);
+            const int64_t tick = utility_datetime::GetTickCountGeneral();
+            const auto it = m_prefetch_input.find(key);
+            if (it != m_prefetch_input.end()) {
+                const PrefetchedOrderInput& pf_input(it->second);
+                const int64_t elapsed = tick - pf_input.m_tick;
+                if (pf_input.m_regist_id < 0) {
+                    if (elapsed < m_prefetch_expire_ms) {
+                        return; // 擾
+                    }
+                    // Ȃ܂܊؂  蒼
+                } else if (elapsed < m_prefetch_expire_ms/2) {
+                    return; // 擾ς(V)
+                }
+            }
+            PrefetchedOrderInput& pf_input(m_prefetch_input[key]);
+            pf_input.m_input_url = url;
+            pf_input.m_regist_id = -1;
+            pf_input.m_tick = tick;
+        }
+        //
+        web::http::http_request request(web::http::methods::GET);
+        utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(), request);
+        m_http_pool.Request(url, request, HttpClientPool::LANE_GENERAL).then([this, url, key, order](web::http::http_response response)
+        {
+            m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
+            m_cookies_gr.Set(response.headers(), url);
+            concurrency::streams::istream bodyStream = response.body();
+            concurrency::streams::container_buffer<std::string> inStringBuffer;
+            return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, key, order](size_t bytesRead)
+            {
+                const int64_t regist_id = GetStockOrderRegistID(inStringBuffer.collection(), order.m_type);
+                //
+                std::lock_guard<std::recursive_mutex> lock(m_mtx);
+                const auto it = m_prefetch_input.find(key);
+                if (it == m_prefetch_input.end()) {
+                    return; // gpς(擾ɔꂽ)
+                }
+                if (regist_id < 0) {
+                    m_prefetch_input.erase(it); // 擾s
+                    return;
+                }
+                PrefetchedOrderInput& pf_input(it->second);
+                pf_input.m_regist_id = regist_id;
+                pf_input.m_number = order.m_number;
+                pf_input.m_confirm_url = std::move(BuildOrderURL(order.m_b_leverage, order.m_type, OSTEP_CONFIRM));
+                pf_input.m_execute_url = std::move(BuildOrderURL(order.m_b_leverage, order.m_type, OSTEP_EXECUTE));
+                pf_input.m_base_form.clear();
+                BuildFreshOrderFormDataWithoutValue(order, pf_input.m_base_form);
+                pf_input.m_tick = utility_datetime::GetTickCountGeneral();
+            });
+        }).then([this, key](pplx::task<void> prev)
+        {
+            try {
+                prev.wait();
+            } catch (...) {
+                // ʐMs/؂  擾(̐ǂ݂Ŏ蒼)
+                std::lock_guard<std::recursive_mutex> lock(m_mtx);
+                const auto it = m_prefetch_input.find(key);
+                if (it != m_prefetch_input.end() && it->second.m_regist_id < 0) {
+                    m_prefetch_input.erase(it);
+                }
+            }
+        });
+    }
+
+    /*!
+     *  @brief  ڑOm
+     *  @note   http_client̓zXgɎg񂷂̂ŁAezXg1xvΐڑc
+     *  @note   ؂ꂽڑ̒蒼łTLSZbVĊJ(OS̃LbV)
+     */
+    void PrewarmConnection()
+    {
+        static const wchar_t* const PREWARM_URL[] = {
+            URL_MAIN_SBI_MAIN, URL_BK_BASE, URL_MAIN_SBI_TRANS_PF_CHECK,
+        };
+        for (const wchar_t* url: PREWARM_URL) {
+            web::http::http_request request(web::http::methods::HEAD);
+            m_http_pool.Request(url, request, HttpClientPool::LANE_KEEPALIVE).then([](pplx::task<web::http::http_response> prev)
+            {
+                try {
+                    prev.wait();
+                } catch (...) {
+                    // sĂ̗vŌq
+                }
+            });
+        }
+    }
+
     /*!
      *  @brief  Mpԍόʎ擾
      *  @param  yymmdd  
@@ -693,8 +1300,7 @@ public:
         //
         web::http::http_request request(web::http::methods::GET);
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(), request);
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, yymmdd, value, callback](web::http::http_response response)
+        m_http_pool.Request(url, request, HttpClientPool::LANE_ORDER).then([this, url, yymmdd, value, callback](web::http::http_response response)
         {
             m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
@@ -723,7 +1329,7 @@ public:
                         const std::string t_yymmddstr(std::move(extract<std::string>(elem[0])));
                         const float64 t_value = extract<float64>(elem[1]);
                         //const int32_t t_number = extract<int32_t>(elem[2]);
-                        const garnet::YYMMDD t_yymmdd(std::move(garnet::YYMMDD::Create(t_yymmddstr)));
+                        const garnet::YYMMDD t_yymmdd(std::move(trade_datetime::ToYYMMDDFromString(t_yymmddstr)));
                         // w肳ꂽEP̋ʂԍς
                         if (trade_utility::same_value(value, t_value) && yymmdd == t_yymmdd) {
                             callback(url,
@@ -737,6 +1343,14 @@ public:
                          false,
                          StockCode().GetCode(), std::string(), std::string());
             });
+        }).then([callback](pplx::task<void> prev)
+        {
+            try {
+                prev.wait();
+            } catch (...) {
+                // ʐMs/؂
+                callback(std::wstring(), false, StockCode().GetCode(), std::string(), std::string());
+            }
         });
     }
 
@@ -845,8 +1459,7 @@ public:
         utility_http::SetHttpCommonHeaderKeepAlive(url, m_cookies_gr, std::wstring(), request);
         utility_http::AddItemToURL(PARAM_NAME_CANCEL_ORDER_ID, std::to_wstring(order_id), url);
         //
-        web::http::client::http_client http_client(url);
-        http_client.request(request).then([this, url, order_id, pwd, callback](web::http::http_response response)
+        CatchOrderFailure(m_http_pool.Request(url, request, HttpClientPool::LANE_CONTROL).then([this, url, order_id, pwd, callback](web::http::http_response response)
         {
             m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
             m_cookies_gr.Set(response.headers(), url);
@@ -855,11 +1468,9 @@ public:
             concurrency::streams::container_buffer<std::string> inStringBuffer;
             return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str, url, order_id, pwd, callback](size_t bytesRead)
             {
-                // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                std::lock_guard<std::recursive_mutex> lock(m_mtx);
-                //
-                const int64_t regist_id
-                    = boost::python::extract<int64_t>(m_python.attr("getStockOrderRegistID")(inStringBuffer.collection(), static_cast<int32_t>(ORDER_CANCEL)));
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_INPUT);
+                const int64_t regist_id = GetStockOrderRegistID(inStringBuffer.collection(), ORDER_CANCEL);
+                StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_INPUT_PARSE);
                 if (regist_id < 0) {
                     callback(false, RcvResponseStockOrder(), date_str);
                     return;
@@ -870,8 +1481,7 @@ public:
                 std::wstring ex_url(URL_BK_CANCELORDER_EXCUTE);
                 utility_http::SetHttpCommonHeaderKeepAlive(ex_url, m_cookies_gr, url, request);
                 BuildCancelOrderFormData(order_id, pwd, regist_id, request);
-                web::http::client::http_client http_client(ex_url);
-                http_client.request(request).then([this, ex_url, order_id, callback](web::http::http_response response)
+                CatchOrderFailure(m_http_pool.Request(ex_url, request, HttpClientPool::LANE_CONTROL).then([this, ex_url, order_id, callback](web::http::http_response response)
                 {
                     m_last_access_tick_mb = utility_datetime::GetTickCountGeneral();
                     m_cookies_gr.Set(response.headers(), ex_url);
@@ -880,23 +1490,60 @@ public:
                     concurrency::streams::container_buffer<std::string> inStringBuffer;
                     return bodyStream.read_to_delim(inStringBuffer, 0).then([this, inStringBuffer, date_str, order_id, callback](size_t bytesRead)
                     {
-                        // python֐dĂяoN蓾(Xebvs͓)̂ŃbNĂ
-                        std::lock_guard<std::recursive_mutex> lock(m_mtx);
-                        //
-                        const std::string& html_u8(inStringBuffer.collection());
-                        using boost::python::tuple;
-                        using boost::python::extract;
-                        const tuple t
-                            = extract<tuple>(m_python.attr("responseStockOrderExec")(html_u8));
+                        StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_EXECUTE);
                         RcvResponseStockOrder rcv_order;
-                        const bool b_result
-                            = ToRcvResponseStockOrderFrom_responseStockOrderExec(t, rcv_order);
+                        const bool b_result = ResponseStockOrderExec(inStringBuffer.collection(), rcv_order);
                         rcv_order.m_order_id = order_id; // response͂ȂǗpԍێĂȂc
+                        StockOrderLatencyTracer::StampOrder(StockOrderLatencyTracer::LSTAGE_EXECUTE_PARSE);
                         callback(b_result, rcv_order, date_str);
                     });
-                });
+                }), callback);
             });
-        });
+        }), callback);
+    }
+
+    /*!
+     *  @brief  ڑvo
+     *  @param  filename    o̓t@C
+     */
+    void OutputConnectionLog(const std::string& filename) const
+    {
+        m_http_pool.OutputLog(filename);
+    }
+    /*!
+     *  @brief  v[vo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLaneLog(const std::string& filename) const
+    {
+        m_http_pool.OutputLaneLog(filename);
+    }
+
+    /*!
+     *  @brief  vvo
+     *  @param  filename    o̓t@C
+     */
+    void OutputPollingLog(const std::string& filename) const
+    {
+        static const char* const POLLING_NAME[NUM_POLLING] = { "valuedata", "execinfo" };
+        std::lock_guard<std::mutex> lock(m_polling_mtx);
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "type,request,skip,stale" << std::endl;
+        for (int32_t inx = 0; inx < NUM_POLLING; inx++) {
+            const PollingState& st(m_polling[inx]);
+            outputfile << POLLING_NAME[inx] << ",";
+            outputfile << st.m_request << "," << st.m_skip << "," << st.m_stale << std::endl;
+        }
+        outputfile.close();
+    }
+
+    /*!
+     *  @brief  html͓vo
+     *  @param  filename    o̓t@C
+     */
+    void OutputParserLog(const std::string& filename) const
+    {
+        m_parse_worker.OutputLog(filename);
     }
 
     /*!
@@ -1079,6 +1726,46 @@ void SecuritiesSessionSbi::CancelOrder(int32_t order_id, const std::wstring& pwd
 }
 
 
+/*!
+ *  @brief  ͐ǂ
+ *  @param  order   (i͖ŗǂ)
+ */
+void SecuritiesSessionSbi::PrefetchOrderInput(const StockOrder& order)
+{
+    m_pImpl->PrefetchOrderInput(order);
+}
+
+/*!
+ *  @brief  ڑOm
+ */
+void SecuritiesSessionSbi::PrewarmConnection()
+{
+    m_pImpl->PrewarmConnection();
+}
+
+
+/*!
+ *  @brief  ڑvo
+ *  @param  log_dir o̓fBNg
+ *  @param  date    N
+ */
+void SecuritiesSessionSbi::OutputConnectionLog(const std::string& log_dir, const garnet::YYMMDD& date) const
+{
+    m_pImpl->OutputConnectionLog(log_dir + "http_connection_" + date.to_string() + ".csv");
+    m_pImpl->OutputPollingLog(log_dir + "http_polling_" + date.to_string() + ".csv");
+    m_pImpl->OutputLaneLog(log_dir + "http_lane_" + date.to_string() + ".csv");
+}
+
+/*!
+ *  @brief  html͓vo
+ *  @param  log_dir o̓fBNg
+ *  @param  date    N
+ */
+void SecuritiesSessionSbi::OutputParserLog(const std::string& log_dir, const garnet::YYMMDD& date) const
+{
+    m_pImpl->OutputParserLog(log_dir + "html_parse_" + date.to_string() + ".csv");
+}
+
 /*!
  *  @brief  ،ЃTCgŏIANZX擾
  */
@@ -59,11 +59,14 @@ public:
     /*!
      *  @brief  Ďif[^擾
      *  @param  callback    R[obN
+     *  @note   {̂O͂̂ƓȂ͂Aif[^̂܂ܐԂ
+     *  @note   Ov̉҂ȂvȂ/ǂzꂽÂ͎̂Ă
      */
     void UpdateValueData(const UpdateValueDataCallback& callback) override;
     /*!
      *  @brief  擾擾
      *  @param  callback    R[obN
+     *  @note   Ov̉҂ȂvȂ/ǂzꂽÂ͎̂Ă
      */
     void UpdateExecuteInfo(const UpdateStockExecInfoCallback& callback) override;
     /*!
@@ -107,7 +110,35 @@ public:
      *  @param  callback    R[obN
      */
     void CancelOrder(int32_t order_id, const std::wstring& pwd, const OrderCallback& callback) override;
+    /*!
+     *  @brief  ͐ǂ
+     *  @param  order   (i͖ŗǂ)
+     *  @note   (EMpVK)̂ݑΉ
+     */
+    void PrefetchOrderInput(const StockOrder& order) override;
+    /*!
+     *  @brief  ڑOm
+     *  @note   SBI̊ezXg(PC/mobile/|[gtHI])HEAD𑗂Đڑ𒣂Ă
+     */
+    void PrewarmConnection() override;
+
 
+    /*!
+     *  @brief  ڑvo
+     *  @param  log_dir o̓fBNg
+     *  @param  date    N
+     *  @note   zXgʂ̗v/ڑ/ėp/؂ꐔ/\v
+     *  @note   v(if[^/)ʂ̗v/ȗ/j
+     *  @note   v[ʂ̗v/M҂/M҂
+     */
+    void OutputConnectionLog(const std::string& log_dir, const garnet::YYMMDD& date) const override;
+    /*!
+     *  @brief  html͓vo
+     *  @param  log_dir o̓fBNg
+     *  @param  date    N
+     *  @note   /ꐔ/ő҂s/҂/͎
+     */
+    void OutputParserLog(const std::string& log_dir, const garnet::YYMMDD& date) const override;
 
     /*!
      *  @brief  ،ЃTCgŏIANZX擾
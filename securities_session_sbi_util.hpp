@@ -172,6 +172,19 @@ std::wstring BuildOrderURL(bool b_leverage, eOrderType type, eOrderStep step)
     return url;
 }
 
+/*!
+ *  @brief  URL\z
+ *  @param  order   
+ *  @return URL
+ */
+std::wstring BuildFreshOrderInputURL(const StockOrder& order)
+{
+    std::wstring url(std::move(BuildOrderURL(order.m_b_leverage, order.m_type, OSTEP_INPUT)));
+    utility_http::AddItemToURL(PARAM_NAME_ORDER_STOCK_CODE, std::to_wstring(order.m_code.GetCode()), url);
+    utility_http::AddItemToURL(PARAM_NAME_ORDER_INVESTIMENTS, GetSbiInvestimentsCode(order.m_investments), url);
+    return url;
+}
+
 /*!
  *  @brief  ԍϔʃXg擾URL\z
  *  @param  otype   
@@ -404,16 +417,14 @@ void BuildOrderValueToFormDataString(float64 value, eOrderCondition cond, std::w
 }
 
 /*!
- *  @brief  VKpFormData\z
- *  @param[in]  order       
- *  @param[in]  pass
- *  @param[in]  regist_id   j[NID(O瓾)
- *  @param[out] request     i[
+ *  @brief  VKpFormData\z(i/pass/regist_idȊO)
+ *  @param[in]  order       (i͎QƂȂ)
+ *  @param[out] form_data   form datap(i[)
+ *  @note   O̓@I\zɂg
+ *  @note   regist_id͒mFƒsňقȂ̂Ŋ܂߂Ȃ(鎞ɕt)
  */
-void BuildFreshOrderFormData(const StockOrder& order, const std::wstring& pass, int64_t regist_id, web::http::http_request& request)
+void BuildFreshOrderFormDataWithoutValue(const StockOrder& order, std::wstring& form_data)
 {
-    std::wstring form_data;
-
     const utility_http::sFormDataParam ORDER_FORM[] = {
         { L"cayen.isStopOrder",     L"false"},  // ttO(=ʏ) tȂtrue
         { L"caLiKbn" ,              L"today"},  // (=)
@@ -424,16 +435,10 @@ void BuildFreshOrderFormData(const StockOrder& order, const std::wstring& pass,
     for (uint32_t inx = 0; inx < sizeof(ORDER_FORM)/sizeof(utility_http::sFormDataParam); inx++) {
         utility_http::AddFormDataParamToString(ORDER_FORM[inx], form_data);
     }
-    utility_http::AddFormDataParamToString(PARAM_NAME_REGIST_ID, std::to_wstring(regist_id), form_data);
     utility_http::AddFormDataParamToString(PARAM_NAME_ORDER_STOCK_BRAND, std::to_wstring(order.GetCode()), form_data);
     utility_http::AddFormDataParamToString(PARAM_NAME_ORDER_STOCK_CODE, std::to_wstring(order.GetCode()), form_data);
     utility_http::AddFormDataParamToString(PARAM_NAME_ORDER_INVESTIMENTS, GetSbiInvestimentsCode(order.m_investments), form_data);
     utility_http::AddFormDataParamToString(L"quantity", std::to_wstring(order.m_number), form_data);
-    BuildOrderValueToFormDataString(order.m_value, order.m_condition, form_data);
-    //
-    if (!pass.empty()) {
-        utility_http::AddFormDataParamToString(PARAM_NAME_PASSWORD, pass, form_data);
-    }
     if (order.m_b_leverage) {
         utility_http::AddFormDataParamToString(PARAM_NAME_LEVERAGE_CATEGORY, L"6", form_data);   // >ToDo< ʐMp/v̑Ή
     }
@@ -446,10 +451,46 @@ void BuildFreshOrderFormData(const StockOrder& order, const std::wstring& pass,
         utility_http::AddFormDataParamToString(PARAM_NAME_ORDER_TYPE, L"sell", form_data);
         break;
     }
+}
+
+/*!
+ *  @brief  VKpFormData\z(\zςݕɉi/pass/regist_idt)
+ *  @param[in]  base_form   BuildFreshOrderFormDataWithoutValueō\z
+ *  @param[in]  order       
+ *  @param[in]  pass
+ *  @param[in]  regist_id   j[NID(O瓾)
+ *  @param[out] request     i[
+ */
+void BuildFreshOrderFormDataFromBase(const std::wstring& base_form,
+                                     const StockOrder& order,
+                                     const std::wstring& pass,
+                                     int64_t regist_id,
+                                     web::http::http_request& request)
+{
+    std::wstring form_data(base_form);
+    utility_http::AddFormDataParamToString(PARAM_NAME_REGIST_ID, std::to_wstring(regist_id), form_data);
+    BuildOrderValueToFormDataString(order.m_value, order.m_condition, form_data);
+    if (!pass.empty()) {
+        utility_http::AddFormDataParamToString(PARAM_NAME_PASSWORD, pass, form_data);
+    }
     //
     utility_http::SetFormData(form_data, request);
 }
 
+/*!
+ *  @brief  VKpFormData\z
+ *  @param[in]  order       
+ *  @param[in]  pass
+ *  @param[in]  regist_id   j[NID(O瓾)
+ *  @param[out] request     i[
+ */
+void BuildFreshOrderFormData(const StockOrder& order, const std::wstring& pass, int64_t regist_id, web::http::http_request& request)
+{
+    std::wstring form_data;
+    BuildFreshOrderFormDataWithoutValue(order, form_data);
+    BuildFreshOrderFormDataFromBase(form_data, order, pass, regist_id, request);
+}
+
 /*!
  *  @brief  MpԍϒpFormData\z
  *  @param[in]  caIQ
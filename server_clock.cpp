@@ -0,0 +1,187 @@
+/*!
+ *  @file   server_clock.cpp
+ *  @brief  T[ov
+ *  @date   2018/01/30
+ */
+#include "server_clock.h"
+
+#include "trade_datetime.h"
+
+#include "garnet_time.h"
+
+#include <cstring>
+
+namespace trading
+{
+
+class ServerClock::PIMPL
+{
+private:
+    enum : int64_t
+    {
+        MS_OF_DAY = 24*60*60*1000,      //!< 1[~b]
+        DRIFT_DIVISOR = 10000,          //!< 銄(oߎԂ1/10000 = 100ppm)
+        JUMP_MS = 60*1000,              //!< ȏ㉺獷蒼[~b]
+    };
+
+    bool m_b_valid;                 //!< ␳ς݃tO
+    int64_t m_offset_ms;            //!< T[o([J/1970Ňo߃~b) - tickCount
+    int64_t m_offset_tick;          //!< ߂tickCount
+    garnet::sTime m_last_sv_time;   //!< ŌɎ󂯎T[o
+
+    int64_t m_now_day;              //!< ݎ1970Ňoߓ(Ȃ疢vZ)
+    int32_t m_now_sec;              //!< ݎ0̌oߕb(Ȃ疢vZ)
+    garnet::sTime m_now_tm;         //!< ݎ
+    garnet::HHMMSS m_now_hhmmss;    //!< ݎb
+
+    PIMPL(const PIMPL&);
+    PIMPL(PIMPL&&);
+    PIMPL& operator= (const PIMPL&);
+
+public:
+    PIMPL()
+    : m_b_valid(false)
+    , m_offset_ms(0)
+    , m_offset_tick(0)
+    , m_last_sv_time()
+    , m_now_day(-1)
+    , m_now_sec(-1)
+    , m_now_tm()
+    , m_now_hhmmss()
+    {
+        memset(reinterpret_cast<void*>(&m_last_sv_time), 0, sizeof(m_last_sv_time));
+        memset(reinterpret_cast<void*>(&m_now_tm), 0, sizeof(m_now_tm));
+    }
+
+    /*!
+     *  @brief  T[oŕ␳
+     *  @param  sv_time     T[o([J)
+     *  @param  tickCount   sv_time󂯎_̌oߎ[~b]
+     */
+    void Correct(const garnet::sTime& sv_time, int64_t tickCount)
+    {
+        m_last_sv_time = sv_time;
+        // b؂̂+x̂ԂAM_̃T[oK()
+        const int64_t lower_ms = trade_datetime::ToEpochSecond(sv_time)*1000 - tickCount;
+        if (!m_b_valid) {
+            m_b_valid = true;
+            m_offset_ms = lower_ms;
+        } else {
+            const int64_t aged_ms = m_offset_ms - (tickCount - m_offset_tick)/DRIFT_DIVISOR;
+            if (lower_ms >= aged_ms || lower_ms + JUMP_MS < aged_ms) {
+                m_offset_ms = lower_ms;
+            } else {
+                m_offset_ms = aged_ms;
+            }
+        }
+        m_offset_tick = tickCount;
+    }
+    bool IsValid() const
+    {
+        return m_b_valid;
+    }
+
+    /*!
+     *  @brief  ݎXV
+     *  @param  tickCount   oߎ[~b]
+     */
+    void Advance(int64_t tickCount)
+    {
+        const int64_t now_ms = tickCount + m_offset_ms;
+        int64_t day = now_ms / MS_OF_DAY;
+        int64_t ms_of_day = now_ms % MS_OF_DAY;
+        if (ms_of_day < 0) {
+            ms_of_day += MS_OF_DAY;
+            day -= 1;
+        }
+        const int32_t sec = static_cast<int32_t>(ms_of_day / 1000);
+        if (day != m_now_day) {
+            m_now_day = day;
+            trade_datetime::ToDateFromEpochDay(day, m_now_tm);
+        }
+        if (sec != m_now_sec) {
+            m_now_sec = sec;
+            m_now_tm.tm_hour = sec / 3600;
+            m_now_tm.tm_min = (sec / 60) % 60;
+            m_now_tm.tm_sec = sec % 60;
+            m_now_hhmmss.m_hour = m_now_tm.tm_hour;
+            m_now_hhmmss.m_minute = m_now_tm.tm_min;
+            m_now_hhmmss.m_second = m_now_tm.tm_sec;
+        }
+    }
+
+    const garnet::sTime& GetTime() const { return m_now_tm; }
+    const garnet::HHMMSS& GetHHMMSS() const { return m_now_hhmmss; }
+    int32_t GetSecondOfDay() const { return m_now_sec; }
+    const garnet::sTime& GetLastServerTime() const { return m_last_sv_time; }
+};
+
+ServerClock::ServerClock()
+: m_pImpl(new PIMPL())
+{
+}
+
+ServerClock::~ServerClock()
+{
+}
+
+/*!
+ *  @brief  T[oŕ␳
+ *  @param  sv_time     T[o([J)
+ *  @param  tickCount   sv_time󂯎_̌oߎ[~b]
+ */
+void ServerClock::Correct(const garnet::sTime& sv_time, int64_t tickCount)
+{
+    m_pImpl->Correct(sv_time, tickCount);
+}
+
+/*!
+ *  @brief  ␳ς݂(xłT[o󂯎)
+ */
+bool ServerClock::IsValid() const
+{
+    return m_pImpl->IsValid();
+}
+
+/*!
+ *  @brief  ݎXV
+ *  @param  tickCount   oߎ[~b]
+ */
+void ServerClock::Advance(int64_t tickCount)
+{
+    m_pImpl->Advance(tickCount);
+}
+
+/*!
+ *  @brief  ݎ(t@W[)𓾂
+ */
+const garnet::sTime& ServerClock::GetTime() const
+{
+    return m_pImpl->GetTime();
+}
+
+/*!
+ *  @brief  ݎb(t@W[)𓾂
+ */
+const garnet::HHMMSS& ServerClock::GetHHMMSS() const
+{
+    return m_pImpl->GetHHMMSS();
+}
+
+/*!
+ *  @brief  ݎ(t@W[)0̌oߕb𓾂
+ */
+int32_t ServerClock::GetSecondOfDay() const
+{
+    return m_pImpl->GetSecondOfDay();
+}
+
+/*!
+ *  @brief  ŌɎ󂯎T[o𓾂
+ */
+const garnet::sTime& ServerClock::GetLastServerTime() const
+{
+    return m_pImpl->GetLastServerTime();
+}
+
+} // namespace trading
@@ -0,0 +1,79 @@
+/*!
+ *  @file   server_clock.h
+ *  @brief  T[ov
+ *  @date   2018/01/30
+ *  @note   P(tickCount)ƃT[o̍ێAt[Ƃ̌ݎx
+ */
+#pragma once
+
+#include "hhmmss.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace garnet { struct sTime; }
+
+namespace trading
+{
+
+/*!
+ *  @brief  T[ov
+ *  @note   httpDate(bP)́uM_̃T[ỏvȂ̂ŁA̍őlƂč̂
+ *  @note   tickCountƃT[o̎v̐iݕ̍(100ppm܂)͍ċz
+ *  @note   傫HႤ(T[ov̏CȂ)󂯎炻̎ō蒼
+ *  @note   XbhZ[tł͂Ȃ(Xbĥݎg)
+ */
+class ServerClock
+{
+public:
+    ServerClock();
+    ~ServerClock();
+
+    /*!
+     *  @brief  T[oŕ␳
+     *  @param  sv_time     T[o([J)
+     *  @param  tickCount   sv_time󂯎_̌oߎ[~b]
+     */
+    void Correct(const garnet::sTime& sv_time, int64_t tickCount);
+    /*!
+     *  @brief  ␳ς݂(xłT[o󂯎)
+     */
+    bool IsValid() const;
+
+    /*!
+     *  @brief  ݎXV
+     *  @param  tickCount   oߎ[~b]
+     *  @note   t[`1xĂ(ȍ~Getn͂̎_̒lԂ)
+     *  @note   t͓ςvZ
+     */
+    void Advance(int64_t tickCount);
+
+    /*!
+     *  @brief  ݎ(t@W[)𓾂
+     */
+    const garnet::sTime& GetTime() const;
+    /*!
+     *  @brief  ݎb(t@W[)𓾂
+     */
+    const garnet::HHMMSS& GetHHMMSS() const;
+    /*!
+     *  @brief  ݎ(t@W[)0̌oߕb𓾂
+     */
+    int32_t GetSecondOfDay() const;
+
+    /*!
+     *  @brief  ŌɎ󂯎T[o𓾂
+     *  @note   ␳O̒l(x꒲⃍Õt@CɎg)
+     */
+    const garnet::sTime& GetLastServerTime() const;
+
+private:
+    ServerClock(const ServerClock&);
+    ServerClock(ServerClock&&);
+    ServerClock& operator= (const ServerClock&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
@@ -15,6 +15,7 @@
 #include "yymmdd.h"
 
 #include <algorithm>
+#include <functional>
 #include <unordered_map>
 
 namespace trading
@@ -42,8 +43,45 @@ private:
 
     //! ʌŗLIDs
     uint32_t m_position_id_source;
-    //! 蒍<ԍ(\p), >
-    std::unordered_map<int32_t, StockExecInfoAtOrder> m_today_exec_order;
+    /*!
+     *  @brief  蒍(1)
+     *  @note   萔(m_info.m_exec.size())𐅈ʂƂāAƂ
+     *  @note   萔ȂenbVŕω𔻒肷(Rs[͂Ȃ)
+     *  @note   se̎w(m_info.m_fingerprint)͔f_ōXV(ۗLƐHȂ悤)
+     */
+    struct TodayExecOrder
+    {
+        StockExecInfoAtOrder m_info;    //!< 
+        size_t m_hash;                  //!< enbV
+
+        TodayExecOrder(const StockExecInfoAtOrder& info)
+        : m_info(info)
+        , m_hash(CalcExecHash(0, info.m_exec, 0))
+        {
+        }
+    };
+    //! 蒍<ԍ(\p), 蒍>
+    std::unordered_map<int32_t, TodayExecOrder> m_today_exec_order;
+    //! ҂<ԍ(\p), M> GetExecInfoDiffŐςUpdateExecInfoŔf
+    std::unordered_map<int32_t, std::vector<StockExecInfo>> m_corrected_exec;
+
+    /*!
+     *  @brief  enbVvZ
+     *  @param  seed    l(vZς݂̃nbV)
+     *  @param  exec    
+     *  @param  begin   vZJnʒu
+     *  @note   ǋLvZł悤AO珇ɏݍ
+     */
+    static size_t CalcExecHash(size_t seed, const std::vector<StockExecInfo>& exec, size_t begin)
+    {
+        const std::hash<float64> hash_value;
+        for (size_t inx = begin; inx < exec.size(); inx++) {
+            const StockExecInfo& ex(exec[inx]);
+            seed ^= static_cast<size_t>(ex.m_number) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            seed ^= hash_value(ex.m_value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
 
     /*!
      *  @brief  ʌŗLIDs
@@ -352,7 +390,7 @@ public:
         if (it == m_today_exec_order.end()) {
             return; // ȂȂ(error)
         }
-        const StockExecInfoAtOrder& ex_info(it->second);
+        const StockExecInfoAtOrder& ex_info(it->second.m_info);
         const eOrderType odtype = ex_info.m_type;
         if (!ex_info.m_b_leverage) {
             return; // ͑ΏۊO
@@ -360,7 +398,7 @@ public:
         if (odtype != ORDER_SELL && odtype != ORDER_BUY) {
             return; // VK̂ݑΏ
         }
-        const auto itPosDat = m_position_data.find(it->second.m_code);
+        const auto itPosDat = m_position_data.find(ex_info.m_code);
         if (itPosDat == m_position_data.end()) {
             return; // ȂwR[ȟʂȂ(error)
         }
@@ -412,41 +450,64 @@ public:
 
     /*!
      *  @brief  ̍𓾂
-     *  @param[in]  rcv_info    M(1t)
-     *  @param[out] diff_info   OƂ̍(i[)    
+     *  @param[in]  rcv_info        M(1t)
+     *  @param[out] diff_info       OƂ̍(i[)    
+     *  @param[out] corrected_id    藚ꂽ̒ԍ(\p)(i[)
+     *  @note   萔etOςĂȂ͓ǂݔ΂
      */
     void GetExecInfoDiff(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                         std::vector<StockExecInfoAtOrder>& diff_info)
+                         std::vector<StockExecInfoAtOrder>& diff_info,
+                         std::vector<int32_t>& corrected_id)
     {
-        diff_info.reserve(rcv_info.size());
+        m_corrected_exec.clear();
         for (const auto& rcv: rcv_info) {
             const auto it = m_today_exec_order.find(rcv.m_user_order_id);
             if (it == m_today_exec_order.end()) {
                 // ԍPʂőO񑶍݂Ȃ܂邲Ɠo^
                 diff_info.emplace_back(rcv);
-            } else {
+                continue;
+            }
+            TodayExecOrder& prev(it->second);
+            if (rcv.m_fingerprint != 0 && rcv.m_fingerprint == prev.m_info.m_fingerprint) {
+                continue; // seO񔽉fƓ(ωȂ)
+            }
+            const size_t prev_num = prev.m_info.m_exec.size();
+            const size_t now_num = rcv.m_exec.size();
+            if (now_num > prev_num) {
                 // O葝Ă獷o^
-                const size_t prev_num = it->second.m_exec.size();
-                const size_t now_num = rcv.m_exec.size();
-                if (now_num > prev_num) {
-                    StockExecInfoAtOrder t_ex(static_cast<const StockExecInfoAtOrderHeader&>(rcv));
-                    t_ex.m_exec.reserve(now_num-prev_num);
-                    for (size_t inx = prev_num; inx < now_num; inx++) {
-                        t_ex.m_exec.emplace_back(it->second.m_exec[inx]);
-                    }
-                    diff_info.emplace_back(std::move(t_ex));
+                StockExecInfoAtOrder t_ex(static_cast<const StockExecInfoAtOrderHeader&>(rcv));
+                t_ex.m_exec.reserve(now_num-prev_num);
+                for (size_t inx = prev_num; inx < now_num; inx++) {
+                    t_ex.m_exec.emplace_back(rcv.m_exec[inx]);
+                }
+                diff_info.emplace_back(std::move(t_ex));
+            } else {
+                const bool b_same_exec
+                    = (now_num == prev_num && CalcExecHash(0, rcv.m_exec, 0) == prev.m_hash);
+                if (b_same_exec && rcv.m_b_complete == prev.m_info.m_b_complete) {
+                    // ωȂ(ȊO̕\ς) f̂Ȃ̂Ŏw䂾킹
+                    prev.m_info.m_fingerprint = rcv.m_fingerprint;
+                    continue;
                 }
+                if (!b_same_exec) {
+                    // 萔œeႤ/萔  (error)
+                    // fς݂̖ē꒼Ƃ͂łȂ̂ŕۗLɂ͔fȂ
+                    // 蒍MeŒu(񍷕ƂďoȂ悤)
+                    m_corrected_exec[rcv.m_user_order_id] = rcv.m_exec;
+                    corrected_id.push_back(rcv.m_user_order_id);
+                }
+                // wb_o^
+                diff_info.emplace_back(static_cast<const StockExecInfoAtOrderHeader&>(rcv));
             }
         }
     }
     /*!
      *  @brief  XV
-     *  @param  rcv_info        M(1t)
      *  @param  diff_info       (OƂ̍)
      *  @param  sv_rep_order    ()ƑΉ锭ςݐMpԍϔ
+     *  @note   蒍͍̂XV
      */
-    void UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                        const std::vector<StockExecInfoAtOrder>& diff_info,
+    void UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& diff_info,
                         const ServerRepLevOrder& sv_rep_order)
     {
         // ۗLɔf
@@ -459,10 +520,28 @@ public:
                 ReflectExecInfoToPosition(diff, sv_rep_order);
             }
         }
-        // ㏑
-        for (const auto& rcv: rcv_info) {
-            m_today_exec_order.emplace(rcv.m_user_order_id, rcv);
+        // XV(ʂi߂)
+        for (const auto& diff: diff_info) {
+            const auto it = m_today_exec_order.find(diff.m_user_order_id);
+            if (it == m_today_exec_order.end()) {
+                m_today_exec_order.emplace(diff.m_user_order_id, TodayExecOrder(diff));
+                continue;
+            }
+            TodayExecOrder& today(it->second);
+            std::vector<StockExecInfo>& exec(today.m_info.m_exec);
+            static_cast<StockExecInfoAtOrderHeader&>(today.m_info) = diff;
+            const auto itCorrected = m_corrected_exec.find(diff.m_user_order_id);
+            if (itCorrected != m_corrected_exec.end()) {
+                //   MeŒu(ʂMeɍ킹)
+                exec.swap(itCorrected->second);
+                today.m_hash = CalcExecHash(0, exec, 0);
+                continue;
+            }
+            const size_t prev_num = exec.size();
+            exec.insert(exec.end(), diff.m_exec.begin(), diff.m_exec.end());
+            today.m_hash = CalcExecHash(today.m_hash, exec, prev_num);
         }
+        m_corrected_exec.clear();
     }
 };
 
@@ -488,25 +567,25 @@ void StockHoldingsKeeper::UpdateHoldings(const SpotTradingsStockContainer& spot,
 
 /*!
  *  @brief  ̍𓾂
- *  @param[in]  rcv_info    M(1t)
- *  @param[out] diff_info   OƂ̍(i[)    
+ *  @param[in]  rcv_info        M(1t)
+ *  @param[out] diff_info       OƂ̍(i[)    
+ *  @param[out] corrected_id    藚ꂽ̒ԍ(\p)(i[)
  */
 void StockHoldingsKeeper::GetExecInfoDiff(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                                          std::vector<StockExecInfoAtOrder>& diff_info)
+                                          std::vector<StockExecInfoAtOrder>& diff_info,
+                                          std::vector<int32_t>& corrected_id)
 {
-    m_pImpl->GetExecInfoDiff(rcv_info, diff_info);
+    m_pImpl->GetExecInfoDiff(rcv_info, diff_info, corrected_id);
 }
 /*!
  *  @brief  XV
- *  @param  rcv_info        M(1t)
  *  @param  diff_info       (OƂ̍)
  *  @param  sv_rep_order    ()ƑΉ锭ςݐMpԍϔ
  */
-void StockHoldingsKeeper::UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                                         const std::vector<StockExecInfoAtOrder>& diff_info,
+void StockHoldingsKeeper::UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& diff_info,
                                          const ServerRepLevOrder& sv_rep_order)
 {
-    m_pImpl->UpdateExecInfo(rcv_info, diff_info, sv_rep_order);
+    m_pImpl->UpdateExecInfo(diff_info, sv_rep_order);
 }
 
 /*!
@@ -40,21 +40,25 @@ public:
                         const StockPositionContainer& position);
     /*!
      *  @brief  XV
-     *  @param  rcv_info        M(1t)
      *  @param  diff_info       (OƂ̍)
      *  @param  sv_rep_order    ()ƑΉ锭ςݐMpԍϔ
+     *  @note   ̖̂萔()i߂
      */
-    void UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                        const std::vector<StockExecInfoAtOrder>& diff_info,
+    void UpdateExecInfo(const std::vector<StockExecInfoAtOrder>& diff_info,
                         const ServerRepLevOrder& sv_rep_order);
 
     /*!
      *  @brief  ̍𓾂
-     *  @param[in]  rcv_info    M(1t)
-     *  @param[out] diff_info   OƂ̍(i[)    
+     *  @param[in]  rcv_info        M(1t)
+     *  @param[out] diff_info       OƂ̍(i[)    
+     *  @param[out] corrected_id    藚ꂽ̒ԍ(\p)(i[)
+     *  @note   萔ƓenbVOƓ͓ǂݔ΂(Rs[Ȃ)
+     *  @note   萔œeႤ/萔͒Ƃ݂ȂAwb_Ƃ
+     *  @note   ꂽ͕ۗLɔfȂ(蒍UpdateExecInfoŒu)
      */
     void GetExecInfoDiff(const std::vector<StockExecInfoAtOrder>& rcv_info,
-                         std::vector<StockExecInfoAtOrder>& diff_info);
+                         std::vector<StockExecInfoAtOrder>& diff_info,
+                         std::vector<int32_t>& corrected_id);
 
     /*!
      *  @brief  `FbN
@@ -0,0 +1,362 @@
+/*!
+ *  @file   stock_order_latency_tracer.cpp
+ *  @brief  oHxv
+ *  @date   2018/01/22
+ */
+#include "stock_order_latency_tracer.h"
+
+#include "latency_histogram.h"
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace trading
+{
+
+namespace
+{
+/*!
+ *  @brief  Wvʂ𓾂
+ *  @param[in]  src qXgO
+ *  @param[out] dst i[
+ */
+void ToSummary(const LatencyHistogram& src, StockOrderLatencyTracer::Summary& dst)
+{
+    dst.m_count = src.GetCount();
+    dst.m_min = src.GetMin();
+    dst.m_max = src.GetMax();
+    dst.m_mean = src.GetMean();
+    dst.m_p50 = src.GetValueAtPercentile(50.0);
+    dst.m_p90 = src.GetValueAtPercentile(90.0);
+    dst.m_p99 = src.GetValueAtPercentile(99.0);
+}
+
+/*!
+ *  @brief  vԖ𓾂
+ *  @param  stage   v
+ */
+const char* GetStageName(StockOrderLatencyTracer::eStage stage)
+{
+    switch (stage)
+    {
+    case StockOrderLatencyTracer::LSTAGE_TRIGGER:       return "trigger";
+    case StockOrderLatencyTracer::LSTAGE_ENTRY:         return "entry";
+    case StockOrderLatencyTracer::LSTAGE_ISSUE:         return "issue";
+    case StockOrderLatencyTracer::LSTAGE_INPUT:         return "input";
+    case StockOrderLatencyTracer::LSTAGE_INPUT_PARSE:   return "input_parse";
+    case StockOrderLatencyTracer::LSTAGE_CONFIRM:       return "confirm";
+    case StockOrderLatencyTracer::LSTAGE_CONFIRM_PARSE: return "confirm_parse";
+    case StockOrderLatencyTracer::LSTAGE_EXECUTE:       return "execute";
+    case StockOrderLatencyTracer::LSTAGE_EXECUTE_PARSE: return "execute_parse";
+    case StockOrderLatencyTracer::LSTAGE_CALLBACK:      return "callback";
+    case StockOrderLatencyTracer::LSTAGE_TOTAL:         return "total";
+    default:                                            return "unknown";
+    }
+}
+/*!
+ *  @brief  ʖ𓾂
+ *  @param  type    
+ */
+const char* GetOrderTypeName(eOrderType type)
+{
+    switch (type)
+    {
+    case ORDER_BUY:     return "buy";
+    case ORDER_SELL:    return "sell";
+    case ORDER_CORRECT: return "correct";
+    case ORDER_CANCEL:  return "cancel";
+    case ORDER_REPSELL: return "repsell";
+    case ORDER_REPBUY:  return "repbuy";
+    default:            return "all";
+    }
+}
+} // namespace
+
+class StockOrderLatencyTracer::PIMPL
+{
+private:
+    mutable std::mutex m_mtx;   //!< rq
+
+    //! ԕ/ʂƂ̃qXgO
+    LatencyHistogram m_histogram[NUM_LSTAGE][NUM_ORDER];
+
+    bool m_b_tracing;               //!< v邩
+    eOrderType m_trace_type;        //!< vF
+    int64_t m_trace_begin_stamp;    //!< vFvJn(Ŝ̋N_)
+    int64_t m_trace_last_stamp;     //!< vFǑv_
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  ԎԂL^(bNςݑO)
+     */
+    void RecordCore(eStage stage, eOrderType type, int64_t begin_stamp, int64_t end_stamp)
+    {
+        if (stage >= NUM_LSTAGE || type >= NUM_ORDER) {
+            return;
+        }
+        m_histogram[stage][type].Record(end_stamp - begin_stamp);
+    }
+
+public:
+    PIMPL()
+    : m_mtx()
+    , m_histogram()
+    , m_b_tracing(false)
+    , m_trace_type(ORDER_NONE)
+    , m_trace_begin_stamp(0)
+    , m_trace_last_stamp(0)
+    {
+    }
+
+    /*!
+     *  @brief  ԎԂL^
+     *  @param  stage       v
+     *  @param  type        
+     *  @param  begin_stamp ԊJn[}CNb]
+     *  @param  end_stamp   ԏI[}CNb]
+     */
+    void Record(eStage stage, eOrderType type, int64_t begin_stamp, int64_t end_stamp)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        RecordCore(stage, type, begin_stamp, end_stamp);
+    }
+
+    /*!
+     *  @brief  vJn
+     *  @param  type            
+     *  @param  trigger_stamp   gK[Jn[}CNb]
+     *  @param  entry_stamp     ߓo^[}CNb]
+     */
+    void BeginOrder(eOrderType type, int64_t trigger_stamp, int64_t entry_stamp)
+    {
+        const int64_t now = GetTimeStamp();
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (entry_stamp > 0) {
+            RecordCore(LSTAGE_ISSUE, type, entry_stamp, now);
+        }
+        m_b_tracing = true;
+        m_trace_type = type;
+        m_trace_begin_stamp = (trigger_stamp > 0) ?trigger_stamp :now;
+        m_trace_last_stamp = now;
+    }
+    /*!
+     *  @brief  v̌v_ʉ
+     *  @param  stage   ʉ߂
+     */
+    void StampOrder(eStage stage)
+    {
+        const int64_t now = GetTimeStamp();
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (!m_b_tracing) {
+            return;
+        }
+        RecordCore(stage, m_trace_type, m_trace_last_stamp, now);
+        m_trace_last_stamp = now;
+    }
+    /*!
+     *  @brief  vI
+     */
+    void EndOrder()
+    {
+        const int64_t now = GetTimeStamp();
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (!m_b_tracing) {
+            return;
+        }
+        RecordCore(LSTAGE_CALLBACK, m_trace_type, m_trace_last_stamp, now);
+        RecordCore(LSTAGE_TOTAL, m_trace_type, m_trace_begin_stamp, now);
+        m_b_tracing = false;
+    }
+    /*!
+     *  @brief  vj
+     */
+    void AbortOrder()
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_b_tracing = false;
+    }
+
+    /*!
+     *  @brief  Wvʎ擾
+     *  @param  stage   v
+     *  @param  type    (ORDER_NONEȂΑSʍZ)
+     *  @param[out] dst i[
+     */
+    bool GetSummary(eStage stage, eOrderType type, Summary& dst) const
+    {
+        if (stage >= NUM_LSTAGE || type >= NUM_ORDER) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (type == ORDER_NONE) {
+            LatencyHistogram sum;
+            for (int32_t inx = ORDER_NONE; inx < NUM_ORDER; inx++) {
+                sum.Add(m_histogram[stage][inx]);
+            }
+            ToSummary(sum, dst);
+        } else {
+            ToSummary(m_histogram[stage][type], dst);
+        }
+        return dst.m_count > 0;
+    }
+
+    /*!
+     *  @brief  Wvʏo
+     *  @param  filename    o̓t@C
+     */
+    void OutputLog(const std::string& filename) const
+    {
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "stage,type,count,min,mean,p50,p90,p99,max" << std::endl;
+        for (int32_t s = 0; s < NUM_LSTAGE; s++) {
+            const eStage stage = static_cast<eStage>(s);
+            for (int32_t t = ORDER_NONE; t < NUM_ORDER; t++) {
+                const eOrderType type = static_cast<eOrderType>(t);
+                Summary sm;
+                if (!GetSummary(stage, type, sm)) {
+                    continue;
+                }
+                outputfile << GetStageName(stage) << "," << GetOrderTypeName(type) << ",";
+                outputfile << sm.m_count << "," << sm.m_min << "," << sm.m_mean << ",";
+                outputfile << sm.m_p50 << "," << sm.m_p90 << "," << sm.m_p99 << ",";
+                outputfile << sm.m_max << std::endl;
+            }
+        }
+        outputfile.close();
+    }
+};
+
+//! g̎Q
+std::weak_ptr<StockOrderLatencyTracer> StockOrderLatencyTracer::m_pInstance;
+
+/*!
+ *  @brief  CX^X(static)
+ *  @return CX^XL|C^
+ */
+std::shared_ptr<StockOrderLatencyTracer> StockOrderLatencyTracer::Create()
+{
+    if (m_pInstance.lock()) {
+        std::shared_ptr<StockOrderLatencyTracer> _empty_instance;
+        return _empty_instance;
+    } else {
+        std::shared_ptr<StockOrderLatencyTracer> _instance(new StockOrderLatencyTracer());
+        m_pInstance = _instance;
+        return _instance;
+    }
+}
+
+/*!
+ *  @brief  vp𓾂(static)
+ *  @return P[}CNb]
+ */
+int64_t StockOrderLatencyTracer::GetTimeStamp()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/*!
+ *  @brief  ԎԂL^(static)
+ *  @param  stage       v
+ *  @param  type        
+ *  @param  begin_stamp ԊJn[}CNb]
+ *  @param  end_stamp   ԏI[}CNb]
+ */
+void StockOrderLatencyTracer::Record(eStage stage, eOrderType type, int64_t begin_stamp, int64_t end_stamp)
+{
+    std::shared_ptr<StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->Record(stage, type, begin_stamp, end_stamp);
+    }
+}
+
+/*!
+ *  @brief  vJn(static)
+ *  @param  type            
+ *  @param  trigger_stamp   gK[Jn[}CNb] (0Ȃs)
+ *  @param  entry_stamp     ߓo^[}CNb] (0Ȃs)
+ */
+void StockOrderLatencyTracer::BeginOrder(eOrderType type, int64_t trigger_stamp, int64_t entry_stamp)
+{
+    std::shared_ptr<StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->BeginOrder(type, trigger_stamp, entry_stamp);
+    }
+}
+/*!
+ *  @brief  v̌v_ʉ(static)
+ *  @param  stage   ʉ߂
+ */
+void StockOrderLatencyTracer::StampOrder(eStage stage)
+{
+    std::shared_ptr<StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->StampOrder(stage);
+    }
+}
+/*!
+ *  @brief  vI(static)
+ */
+void StockOrderLatencyTracer::EndOrder()
+{
+    std::shared_ptr<StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->EndOrder();
+    }
+}
+/*!
+ *  @brief  vj(static)
+ */
+void StockOrderLatencyTracer::AbortOrder()
+{
+    std::shared_ptr<StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->AbortOrder();
+    }
+}
+
+/*!
+ *  @brief  Wvʎ擾(static)
+ *  @param  stage   v
+ *  @param  type    (ORDER_NONEȂΑSʍZ)
+ *  @param[out] dst i[
+ *  @retval true    (1ȏvĂ)
+ */
+bool StockOrderLatencyTracer::GetSummary(eStage stage, eOrderType type, Summary& dst)
+{
+    std::shared_ptr<const StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        return p->m_pImpl->GetSummary(stage, type, dst);
+    } else {
+        return false;
+    }
+}
+
+/*!
+ *  @brief  Wvʏo(static)
+ *  @param  filename    o̓t@C
+ */
+void StockOrderLatencyTracer::OutputLog(const std::string& filename)
+{
+    std::shared_ptr<const StockOrderLatencyTracer> p = m_pInstance.lock();
+    if (nullptr != p) {
+        p->m_pImpl->OutputLog(filename);
+    }
+}
+
+/*!
+ */
+StockOrderLatencyTracer::StockOrderLatencyTracer()
+: m_pImpl(new PIMPL())
+{
+}
+/*!
+ */
+StockOrderLatencyTracer::~StockOrderLatencyTracer()
+{
+}
+
+} // namespace trading
@@ -0,0 +1,156 @@
+/*!
+ *  @file   stock_order_latency_tracer.h
+ *  @brief  oHxv
+ *  @date   2018/01/22
+ *  @note   gK[甭ʎM܂ł̋ԂƂ̏vԂWv
+ */
+#pragma once
+
+#include "trade_define.h"
+
+#include <memory>
+#include <string>
+
+namespace trading
+{
+
+/*!
+ *  @brief  oHxv
+ *  @note   singleton
+ *  @note   CX^X͖Iɐ(ďoshared_ptrŕێ)
+ *  @note   1(Ǘ҂̌ʑ҂͗vf10)OŁA
+ *  @note   `̊Ԃ́uvv1ێ
+ */
+class StockOrderLatencyTracer
+{
+public:
+    /*!
+     *  @brief  v
+     *  @note   eԂ͒Ǒv_̌oߎ
+     */
+    enum eStage
+    {
+        LSTAGE_TRIGGER = 0,     //!< gK[(헪ߊJn`ߐ)
+        LSTAGE_ENTRY,           //!< ߓo^(EntryCommand)
+        LSTAGE_ISSUE,           //!< ߓo^`(IssueOrder)
+        LSTAGE_INPUT,           //!< `͉M
+        LSTAGE_INPUT_PARSE,     //!< ͉(python)
+        LSTAGE_CONFIRM,         //!< mFM`M
+        LSTAGE_CONFIRM_PARSE,   //!< mF(python)
+        LSTAGE_EXECUTE,         //!< sM`M
+        LSTAGE_EXECUTE_PARSE,   //!< s(python)
+        LSTAGE_CALLBACK,        //!< R[obN(StockOrderCallback)
+        LSTAGE_TOTAL,           //!< S(gK[Jn`R[obN)
+
+        NUM_LSTAGE
+    };
+
+    /*!
+     *  @brief  Wv
+     *  @note   Ԃ͑Să}CNb
+     *  @note   p[Z^Cl̓oPbgl(덷͍ő1/16)
+     */
+    struct Summary
+    {
+        int64_t m_count;    //!< v
+        int64_t m_min;      //!< ŏ
+        int64_t m_max;      //!< ő
+        int64_t m_mean;     //!< 
+        int64_t m_p50;      //!< 50p[Z^C
+        int64_t m_p90;      //!< 90p[Z^C
+        int64_t m_p99;      //!< 99p[Z^C
+
+        Summary()
+        : m_count(0)
+        , m_min(0)
+        , m_max(0)
+        , m_mean(0)
+        , m_p50(0)
+        , m_p90(0)
+        , m_p99(0)
+        {
+        }
+    };
+
+    /*!
+     *  @brief  CX^X + 
+     *  @return CX^XL|C^
+     *  @note   ς݂Ȃshared_ptrԂ
+     */
+    static std::shared_ptr<StockOrderLatencyTracer> Create();
+
+    /*!
+     *  @brief  vp𓾂
+     *  @return P[}CNb]
+     */
+    static int64_t GetTimeStamp();
+
+    /*!
+     *  @brief  ԎԂL^
+     *  @param  stage       v
+     *  @param  type        
+     *  @param  begin_stamp ԊJn[}CNb]
+     *  @param  end_stamp   ԏI[}CNb]
+     */
+    static void Record(eStage stage, eOrderType type, int64_t begin_stamp, int64_t end_stamp);
+
+    /*!
+     *  @brief  vJn
+     *  @param  type            
+     *  @param  trigger_stamp   gK[Jn[}CNb] (0Ȃs)
+     *  @param  entry_stamp     ߓo^[}CNb] (0Ȃs)
+     *  @note   IssueOrderĂ
+     */
+    static void BeginOrder(eOrderType type, int64_t trigger_stamp, int64_t entry_stamp);
+    /*!
+     *  @brief  v̌v_ʉ
+     *  @param  stage   ʉ߂
+     *  @note   Ǒv_̌oߎԂstageƂċL^
+     *  @note   vȂΉȂ
+     */
+    static void StampOrder(eStage stage);
+    /*!
+     *  @brief  vI
+     *  @note   R[obNԂƑŜL^Čvj
+     */
+    static void EndOrder();
+    /*!
+     *  @brief  vj
+     *  @note   łȂꍇp
+     */
+    static void AbortOrder();
+
+    /*!
+     *  @brief  Wvʎ擾
+     *  @param  stage   v
+     *  @param  type    (ORDER_NONEȂΑSʍZ)
+     *  @param[out] dst i[
+     *  @retval true    (1ȏvĂ)
+     */
+    static bool GetSummary(eStage stage, eOrderType type, Summary& dst);
+
+    /*!
+     *  @brief  Wvʏo
+     *  @param  filename    o̓t@C
+     *  @note   csv`
+     */
+    static void OutputLog(const std::string& filename);
+
+    /*!
+     */
+    ~StockOrderLatencyTracer();
+
+private:
+    StockOrderLatencyTracer();
+    StockOrderLatencyTracer(const StockOrderLatencyTracer&);
+    StockOrderLatencyTracer(StockOrderLatencyTracer&&);
+    StockOrderLatencyTracer& operator= (const StockOrderLatencyTracer&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+
+    //! g̎Q
+    static std::weak_ptr<StockOrderLatencyTracer> m_pInstance;
+};
+
+} // namespace trading
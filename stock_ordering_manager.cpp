@@ -5,14 +5,18 @@
  */
 #include "stock_ordering_manager.h"
 
+#include "scope_profiler.h"
 #include "securities_session.h"
 #include "stock_holdings_keeper.h"
 #include "stock_holdings.h"
+#include "stock_order_latency_tracer.h"
 #include "stock_portfolio.h"
 #include "stock_trading_command_fwd.h"
 #include "stock_trading_command.h"
 #include "stock_trading_tactics.h"
+#include "thread_affinity.h"
 #include "trade_assistant_setting.h"
+#include "trade_datetime.h"
 #include "trade_struct.h"
 #include "trade_utility.h"
 #include "update_message.h"
@@ -77,16 +81,16 @@ private:
         int32_t m_tactics_id;
         std::unordered_set<int32_t> m_group;
 
-        int64_t m_timer; //! c莞
+        TimerWheel::TimerID m_timer_id; //! ^C}[
 
         EmergencyModeState(uint32_t code,
                            int32_t tactics_id,
                            const std::unordered_set<int32_t>& group,
-                           int64_t timer)
+                           TimerWheel::TimerID timer_id)
         : m_code(code)
         , m_tactics_id(tactics_id)
         , m_group(group)
-        , m_timer(timer)
+        , m_timer_id(timer_id)
         {
         }
 
@@ -102,6 +106,10 @@ private:
     SecuritiesSessionPtr m_pSecSession;
     //! twitterƂ̃ZbV
     garnet::TwitterSessionForAuthorPtr m_pTwSession;
+    //! Mʓ֐(𔄔Xbhŏ)
+    PostResultFunc m_post_func;
+    //! (@؂)
+    TimerWheel& m_timer;
 
     //! 헪f[^<헪ID, 헪f[^>
     std::unordered_map<int32_t, StockTradingTactics> m_tactics;
@@ -141,6 +149,10 @@ private:
     int64_t m_tick_count;
     //! ŏI(tick)
     int64_t m_last_tick_rcv_rep_order;
+    //! ͐ǂݐڋߗ[%] Oݒ肩擾/0ȉȂǂ݂Ȃ
+    const float32 m_prefetch_distance;
+    //! if[^XVꂽ(ǂݔp)
+    bool m_b_update_valuedata;
 
     /*!
      *  @brief  胁bZ[Wo
@@ -261,6 +273,8 @@ private:
                 m_b_lock_odmng_and_wait_execinfo = true;
             }
         }
+        // xvI
+        StockOrderLatencyTracer::EndOrder();
     }
 
     /*!
@@ -276,11 +290,29 @@ private:
             if (emstat.m_code == code && emstat.m_tactics_id == tactics_id) {
                 // łɂ΍XV
                 emstat.AddGroupID(em_group);
-                emstat.m_timer = m_emergency_time_ms;
+                m_timer.ResetTimer(emstat.m_timer_id, m_emergency_time_ms);
                 return;
             }
         }
-        m_emergency_state.emplace_back(code, tactics_id, em_group, m_emergency_time_ms);
+        // 
+        const TimerWheel::TimerID timer_id
+            = m_timer.SetTimer(m_emergency_time_ms, [this, code, tactics_id](int64_t) {
+            m_emergency_state.remove_if([code, tactics_id](const EmergencyModeState& emstat) {
+                return emstat.m_code == code && emstat.m_tactics_id == tactics_id;
+            });
+        });
+        m_emergency_state.emplace_back(code, tactics_id, em_group, timer_id);
+    }
+
+    /*!
+     *  @brief  ً}[hԑS
+     */
+    void ClearEmergencyState()
+    {
+        for (const auto& emstat: m_emergency_state) {
+            m_timer.KillTimer(emstat.m_timer_id);
+        }
+        m_emergency_state.clear();
     }
 
     /*!
@@ -408,6 +440,7 @@ private:
     void EntryCommand(const StockTradingCommandPtr& command_ptr, 
                       eStockInvestmentsType investments)
     {
+        TRADE_PROFILE_SCOPE(PHASE_ENTRY_COMMAND);
         if (m_b_lock_odmng_and_wait_execinfo) {
             return;
         }
@@ -559,6 +592,27 @@ private:
         }
     }
 
+    /*!
+     *  @brief  ً}[hΏۃO[v擾
+     *  @param  code        R[h
+     *  @param  tactics_id  헪ID
+     *  @param  blank_group ً}[hłȂꍇɕԂO[v
+     */
+    const std::unordered_set<int32_t>& GetEmergencyGroup(uint32_t code,
+                                                         int32_t tactics_id,
+                                                         const std::unordered_set<int32_t>& blank_group) const
+    {
+        const auto itEmStat
+            = std::find_if(m_emergency_state.begin(),
+                           m_emergency_state.end(),
+                           [code, tactics_id](const EmergencyModeState& emstat)
+        {
+            return emstat.m_code == code && emstat.m_tactics_id == tactics_id;
+        });
+        return (itEmStat != m_emergency_state.end()) ?itEmStat->m_group 
+                                                     :blank_group;
+    }
+
     /*!
      *  @brief  헪
      *  @param  investments ݎ
@@ -573,6 +627,7 @@ private:
                           const std::unordered_map<uint32_t, StockValueData>& valuedata,
                           TradeAssistantSetting& script_mng)
     {
+        TRADE_PROFILE_SCOPE(PHASE_INTERPRET_TACTICS);
         std::unordered_set<int32_t> blank_group;
         for (const auto& link: m_tactics_link) {
             const uint32_t code = link.first;
@@ -583,24 +638,68 @@ private:
                 continue; // if[^܂Ȃ
             }
             //
-            const auto itEmStat
-                = std::find_if(m_emergency_state.begin(),
-                               m_emergency_state.end(),
-                               [code, tactics_id](const EmergencyModeState& emstat)
-            {
-                return emstat.m_code == code && emstat.m_tactics_id == tactics_id;
-            });
-            //
-            const auto& r_group =
-                (itEmStat != m_emergency_state.end()) ?itEmStat->m_group 
-                                                      :blank_group;
+            const auto& r_group = GetEmergencyGroup(code, tactics_id, blank_group);
             auto tactics(m_tactics[tactics_id]);
+            const int64_t trigger_stamp = StockOrderLatencyTracer::GetTimeStamp();
             tactics.Interpret(investments, now_time, sec_time,
                               r_group, itVData->second,
                               script_mng,
-                              [this, investments](const StockTradingCommandPtr& command_ptr)
+                              [this, investments, trigger_stamp](const StockTradingCommandPtr& command_ptr)
             {
+                const int64_t entry_stamp = StockOrderLatencyTracer::GetTimeStamp();
                 EntryCommand(command_ptr, investments);
+                const int64_t entried_stamp = StockOrderLatencyTracer::GetTimeStamp();
+                // xv(gK[/ߓo^)
+                const eOrderType type = command_ptr->GetOrderType();
+                StockOrderLatencyTracer::Record(StockOrderLatencyTracer::LSTAGE_TRIGGER,
+                                                type, trigger_stamp, entry_stamp);
+                StockOrderLatencyTracer::Record(StockOrderLatencyTracer::LSTAGE_ENTRY,
+                                                type, entry_stamp, entried_stamp);
+                command_ptr->SetLatencyStamp(trigger_stamp, entried_stamp);
+            });
+        }
+    }
+
+    /*!
+     *  @brief  ߂̒͂ǂ݂
+     *  @param  investments ݎ
+     *  @param  now_time    ݎb
+     *  @param  sec_time    ZNVJn
+     *  @param  valuedata   if[^(1)
+     *  @param  script_mng  Oݒ(XNvg)Ǘ
+     *  @note   if[^XV̂ݔ肷
+     */
+    void PrefetchNearOrder(eStockInvestmentsType investments,
+                           const garnet::HHMMSS& now_time,
+                           const garnet::HHMMSS& sec_time,
+                           const std::unordered_map<uint32_t, StockValueData>& valuedata,
+                           TradeAssistantSetting& script_mng)
+    {
+        TRADE_PROFILE_SCOPE(PHASE_PREFETCH_ORDER);
+        if (m_prefetch_distance <= 0.f || !m_b_update_valuedata) {
+            return;
+        }
+        m_b_update_valuedata = false;
+        if (m_b_lock_odmng_and_wait_execinfo) {
+            return; // bN͐ǂ݂ĂʂɂȂ
+        }
+        std::unordered_set<int32_t> blank_group;
+        for (const auto& link: m_tactics_link) {
+            const uint32_t code = link.first;
+            const int32_t tactics_id = link.second;
+            //
+            const auto itVData = valuedata.find(code);
+            if (itVData == valuedata.end()) {
+                continue; // if[^܂Ȃ
+            }
+            //
+            const auto& r_group = GetEmergencyGroup(code, tactics_id, blank_group);
+            m_tactics[tactics_id].InterpretNear(investments, now_time, sec_time,
+                                                r_group, itVData->second,
+                                                script_mng, m_prefetch_distance,
+                                                [this](const StockOrder& order)
+            {
+                m_pSecSession->PrefetchOrderInput(order);
             });
         }
     }
@@ -620,7 +719,10 @@ private:
         const auto callback = [this, investments](bool b_result,
                                                   const RcvResponseStockOrder& rcv_order,
                                                   const std::wstring& sv_date) {
-            StockOrderCallback(b_result, rcv_order, sv_date, investments);
+            // http֘AXbhĂ΂̂ŔXbhŏ
+            m_post_func([this, investments, b_result, rcv_order, sv_date]() {
+                StockOrderCallback(b_result, rcv_order, sv_date, investments);
+            });
         };
 
         if (!command.IsOrder()) {
@@ -703,6 +805,7 @@ private:
                     const garnet::CipherAES_string& aes_pwd,
                     int64_t tickCount)
     {
+        TRADE_PROFILE_SCOPE(PHASE_ISSUE_ORDER);
         if (m_command_list.empty()) {
             return; // 
         }
@@ -715,9 +818,13 @@ private:
         m_wait_order.push_back(command_ptr);
         m_command_list.pop_front();
 
+        StockOrderLatencyTracer::BeginOrder(command.GetOrderType(),
+                                            command.GetTriggerStamp(),
+                                            command.GetEntryStamp());
         if (!IssueOrderCore(command, investments, aes_pwd, tickCount)) {
             // łȂ猋ʑ҂폜(OŋN蓾)
             m_wait_order.pop_back();
+            StockOrderLatencyTracer::AbortOrder();
         }
     }
 
@@ -726,13 +833,19 @@ public:
     /*!
      *  @param  sec_session ،ЂƂ̃ZbV
      *  @param  tw_session  twitterƂ̃ZbV
+     *  @param  post_func   Mʓ֐
+     *  @param  timer       
      *  @param  script_mng  Oݒ(XNvg)Ǘ
      */
     PIMPL(const SecuritiesSessionPtr& sec_session,
           const garnet::TwitterSessionForAuthorPtr& tw_session,
+          const PostResultFunc& post_func,
+          TimerWheel& timer,
           TradeAssistantSetting& script_mng)
     : m_pSecSession(sec_session)
     , m_pTwSession(tw_session)
+    , m_post_func(post_func)
+    , m_timer(timer)
     , m_tactics()
     , m_tactics_link()
     , m_emergency_time_ms(
@@ -751,12 +864,21 @@ public:
     , m_periodoftime(PERIOD_NONE)
     , m_tick_count(0)
     , m_last_tick_rcv_rep_order(0)
+    , m_prefetch_distance(script_mng.GetOrderPrefetchDistancePercent())
+    , m_b_update_valuedata(false)
     {
         UpdateMessage msg;
         if (!script_mng.BuildStockTactics(msg, m_tactics, m_tactics_link)) {
             // s(error)
         }
     }
+    /*!
+     *  @note   ^C}[͔@̎Ȃ̂Ŏ̕Ă
+     */
+    ~PIMPL()
+    {
+        ClearEmergencyState();
+    }
 
     /*!
      *  @brief  ،Ђ̕ԓ҂Ă邩
@@ -766,6 +888,22 @@ public:
     {
         return !m_wait_order.empty();
     }
+    /*!
+     *  @brief  }œ
+     *  @retval true    ςݒA܂͔sŔbN
+     */
+    bool IsInWaitExecInfo() const
+    {
+        if (m_b_lock_odmng_and_wait_execinfo) {
+            return true;
+        }
+        for (const auto& sv_order: m_server_order) {
+            if (!sv_order.second.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
     
     /*!
      *  @brief  ĎR[h擾
@@ -817,6 +955,7 @@ public:
     {
         const auto outputLog = [log_dir, date](StockValueData vdata, std::string pts_tag)
         {
+            thread_affinity::ApplyCurrentThread(thread_affinity::ROLE_WORKER);
             const std::string code_str(std::move(std::to_string(vdata.m_code.GetCode())));
             const std::string date_str(std::move(date.to_string()));
             vdata.OutputLog(std::move(log_dir + pts_tag + code_str + "_" + date_str + ".csv"));
@@ -842,6 +981,16 @@ public:
                 t.detach();
             }
         }
+        // oHxWv
+        {
+            const std::string filename(log_dir + "order_latency_" + date.to_string() + ".csv");
+            std::thread t([filename]()
+            {
+                thread_affinity::ApplyCurrentThread(thread_affinity::ROLE_WORKER);
+                StockOrderLatencyTracer::OutputLog(filename);
+            });
+            t.detach();
+        }
     }
     
     /*!
@@ -857,13 +1006,13 @@ public:
         auto itMtd = m_monitoring_data.find(investments_type);
         if (itMtd != m_monitoring_data.end()) {
             garnet::sTime tm_send; // if[^M(T[o^C)
-            auto pt(garnet::utility_datetime::ToLocalTimeFromRFC1123(sendtime));
-            garnet::utility_datetime::ToTimeFromBoostPosixTime(pt, tm_send);
+            trade_datetime::ToLocalTimeFromRFC1123(sendtime, tm_send);
             auto& valuedata(itMtd->second);
             for (const auto& vunit: rcv_valuedata) {
                 auto it = valuedata.find(vunit.m_code);
                 if (it != valuedata.end()) {
                     it->second.UpdateValueData(vunit, tm_send);
+                    m_b_update_valuedata = true;
                 } else {
                     // ȂǂH(error)
                 }
@@ -901,7 +1050,16 @@ public:
 
         // 荷(OXVɖ肵)𓾂
         std::vector<StockExecInfoAtOrder> diff_info;
-        m_holdings.GetExecInfoDiff(rcv_info, diff_info);
+        std::vector<int32_t> corrected_id;
+        m_holdings.GetExecInfoDiff(rcv_info, diff_info, corrected_id);
+        if (!corrected_id.empty()) {
+            // 藚ꂽ(ۗLɂ͔fȂ̂ŒʒmĂ)
+            std::wstring err_msg;
+            for (const int32_t user_order_id: corrected_id) {
+                AddErrorMsg(L"%exec corrected: " + std::to_wstring(user_order_id), err_msg);
+            }
+            m_pTwSession->Tweet(std::wstring(), L"藚" + GetErrorMsgHeader() + err_msg);
+        }
         if (diff_info.empty()) {
             return ; // ωȂ
         }
@@ -922,8 +1080,8 @@ public:
             rep_order.emplace(user_order_id, itOrder->second);
         }
         // ۗLǗXV
-        m_holdings.UpdateExecInfo(rcv_info, diff_info, rep_order);
-        // ςݒXV
+        m_holdings.UpdateExecInfo(diff_info, rep_order);
+        // ςݒXV ʂ͖ȊO(ۗLXV)łȂȂ̂őS
         for (auto it = m_exec_order.begin(); it != m_exec_order.end(); it++) {
             // Rt"ۗL"ȂȂĂ"ςݒ"폜
             const StockCode s_code(it->first);
@@ -1003,31 +1161,22 @@ public:
                 const garnet::CipherAES_string& aes_pwd,
                 TradeAssistantSetting& script_mng)
     {
+        TRADE_PROFILE_SCOPE(PHASE_ORDERING_UPDATE);
         // ʂς獡閽߃Xgetcj
         if (investments != m_investments) {
             m_command_list.clear();
-            m_emergency_state.clear();
+            ClearEmergencyState();
         }
 
-        // ً}[hԍXV
-        {
-            const int64_t diff_time = tickCount - m_tick_count;
-            auto itRmv = std::remove_if(m_emergency_state.begin(),
-                                        m_emergency_state.end(),
-                                        [diff_time](EmergencyModeState& emstat)
-            {
-                emstat.m_timer -= diff_time;
-                return emstat.m_timer <= 0;
-            });
-            if (itRmv != m_emergency_state.end()) {
-                m_emergency_state.erase(itRmv, m_emergency_state.end());
-            }
-        }
+        // ً}[hԂ̉̓^C}[ŏ
         // 헪
         InterpretTactics(investments, now_time, sec_time,
                          m_monitoring_data[investments], script_mng);
         // ߏ
         IssueOrder(investments, aes_pwd, tickCount);
+        // ͐ǂ
+        PrefetchNearOrder(investments, now_time, sec_time,
+                          m_monitoring_data[investments], script_mng);
         //
         m_tick_count = tickCount;
         m_investments = investments;
@@ -1038,12 +1187,16 @@ public:
 /*!
  *  @param  sec_session ،ЂƂ̃ZbV
  *  @param  tw_session  twitterƂ̃ZbV
+ *  @param  post_func   Mʓ֐
+ *  @param  timer       
  *  @param  script_mng  Oݒ(XNvg)Ǘ
  */
 StockOrderingManager::StockOrderingManager(const SecuritiesSessionPtr& sec_session,
                                            const garnet::TwitterSessionForAuthorPtr& tw_session,
+                                           const PostResultFunc& post_func,
+                                           TimerWheel& timer,
                                            TradeAssistantSetting& script_mng)
-: m_pImpl(new PIMPL(sec_session, tw_session, script_mng))
+: m_pImpl(new PIMPL(sec_session, tw_session, post_func, timer, script_mng))
 {
 }
 /*!
@@ -1060,6 +1213,14 @@ bool StockOrderingManager::IsInWaitMessageFromSecurities() const
 {
     return m_pImpl->IsInWaitMessageFromSecurities();
 }
+/*!
+ *  @brief  }œ
+ *  @note   ςݒA܂͔sȂtrue
+ */
+bool StockOrderingManager::IsInWaitExecInfo() const
+{
+    return m_pImpl->IsInWaitExecInfo();
+}
 
 /*!
  *  @brief  ĎR[h擾
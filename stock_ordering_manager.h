@@ -5,7 +5,9 @@
  */
 #pragma once
 
+#include "mpsc_queue.h"
 #include "securities_session_fwd.h"
+#include "timer_wheel.h"
 #include "trade_container.h"
 #include "trade_define.h"
 
@@ -37,10 +39,15 @@ public:
     /*!
      *  @param  sec_session ،ЂƂ̃ZbV
      *  @param  tw_session  twitterƂ̃ZbV
+     *  @param  post_func   Mʓ֐
+     *  @param  timer       (Ǘ҂蒷邱)
      *  @param  script_mng  Oݒ(XNvg)Ǘ
+     *  @note   post_funcŔXbhɓnĂ珈
      */
     StockOrderingManager(const SecuritiesSessionPtr& sec_session,
                          const garnet::TwitterSessionForAuthorPtr& tw_session,
+                         const PostResultFunc& post_func,
+                         TimerWheel& timer,
                          TradeAssistantSetting& script_mng);
     /*!
      */
@@ -51,6 +58,11 @@ public:
      *  @retval true    ʑ҂Ă
      */
     bool IsInWaitMessageFromSecurities() const;
+    /*!
+     *  @brief  }œ
+     *  @retval true    ςݒA܂͔sŔbN
+     */
+    bool IsInWaitExecInfo() const;
 
     /*!
      *  @brief  ĎR[h擾
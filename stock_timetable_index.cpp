@@ -0,0 +1,185 @@
+/*!
+ *  @file   stock_timetable_index.cpp
+ *  @brief  ^Ce[u/ԑы敪̕b\
+ *  @date   2018/01/29
+ */
+#include "stock_timetable_index.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace trading
+{
+
+class StockTimeTableIndex::PIMPL
+{
+private:
+    //! Ԕԍ
+    typedef uint16_t SectionIndex;
+
+    /*!
+     *  @brief  \zp̕bƂ̓e
+     */
+    struct SecondWork
+    {
+        int32_t m_tt_index;     //!< ̗pTT̔ԍ(ȂȂ畉)
+        StockTimeTableUnit::eMode m_mode;
+        StockTimeTableUnit::eMode m_next_mode;
+        eStockPeriodOfTime m_period;
+        int32_t m_next_trade_sec;
+
+        bool operator==(const SecondWork& right) const
+        {
+            return m_tt_index == right.m_tt_index &&
+                   m_mode == right.m_mode &&
+                   m_next_mode == right.m_next_mode &&
+                   m_period == right.m_period &&
+                   m_next_trade_sec == right.m_next_trade_sec;
+        }
+    };
+
+    std::vector<SectionIndex> m_index;  //!< bԔԍ
+    std::vector<Section> m_section;     //!< 
+
+    PIMPL(const PIMPL&);
+    PIMPL(PIMPL&&);
+    PIMPL& operator= (const PIMPL&);
+
+public:
+    PIMPL()
+    : m_index(SECONDS_OF_DAY, 0)
+    , m_section(1)
+    {
+    }
+
+    /*!
+     *  @brief  \\z
+     *  @param  timetable       ^Ce[u(~)
+     *  @param  periodoftime    ԑы敪
+     */
+    bool Build(const std::vector<StockTimeTableUnit>& timetable,
+               const std::vector<StockPeriodOfTimeUnit>& periodoftime)
+    {
+        // r͕bōs(HHMMSS̑召ƌoߕb̑召͈v)
+        std::vector<int32_t> tt_sec;
+        tt_sec.reserve(timetable.size());
+        for (const auto& tt: timetable) {
+            tt_sec.push_back(tt.m_hhmmss.GetPastSecond());
+        }
+        std::vector<std::pair<int32_t, int32_t>> pot_sec;
+        pot_sec.reserve(periodoftime.size());
+        for (const auto& pot: periodoftime) {
+            pot_sec.emplace_back(pot.m_start.GetPastSecond(), pot.m_end.GetPastSecond());
+        }
+
+        std::vector<SectionIndex> index(SECONDS_OF_DAY, 0);
+        std::vector<Section> section;
+        SecondWork prev_work;
+        for (int32_t sec = 0; sec < SECONDS_OF_DAY; sec++) {
+            SecondWork work;
+            // TT[h(~ɌčŏɌݎO/ȂCLOSED)
+            work.m_tt_index = -1;
+            work.m_mode = StockTimeTableUnit::CLOSED;
+            work.m_next_mode = StockTimeTableUnit::CLOSED;
+            {
+                StockTimeTableUnit::eMode mode = StockTimeTableUnit::CLOSED;
+                for (size_t inx = 0; inx < timetable.size(); inx++) {
+                    work.m_next_mode = mode;
+                    mode = timetable[inx].m_mode;
+                    if (tt_sec[inx] < sec) {
+                        work.m_tt_index = static_cast<int32_t>(inx);
+                        work.m_mode = mode;
+                        break;
+                    }
+                }
+            }
+            // ԑы敪
+            work.m_period = PERIOD_NONE;
+            for (size_t inx = 0; inx < periodoftime.size(); inx++) {
+                if (pot_sec[inx].first <= sec && sec <= pot_sec[inx].second) {
+                    work.m_period = periodoftime[inx].m_period;
+                    break;
+                }
+            }
+            // ̔Jn(ł߂)
+            work.m_next_trade_sec = -1;
+            for (size_t inx = 0; inx < timetable.size(); inx++) {
+                const auto mode = timetable[inx].m_mode;
+                if (StockTimeTableUnit::TOKYO != mode && StockTimeTableUnit::PTS != mode) {
+                    continue;
+                }
+                if (tt_sec[inx] > sec &&
+                    (work.m_next_trade_sec < 0 || tt_sec[inx] < work.m_next_trade_sec)) {
+                    work.m_next_trade_sec = tt_sec[inx];
+                }
+            }
+            //
+            if (section.empty() || !(work == prev_work)) {
+                if (section.size() > std::numeric_limits<SectionIndex>::max()) {
+                    return false;
+                }
+                if (!section.empty()) {
+                    section.back().m_end_sec = sec;
+                }
+                Section sect;
+                sect.m_mode = work.m_mode;
+                sect.m_next_mode = work.m_next_mode;
+                if (work.m_tt_index >= 0) {
+                    sect.m_start = timetable[work.m_tt_index].m_hhmmss;
+                }
+                sect.m_period = work.m_period;
+                sect.m_next_trade_sec = work.m_next_trade_sec;
+                sect.m_end_sec = SECONDS_OF_DAY;
+                section.emplace_back(sect);
+                prev_work = work;
+            }
+            index[sec] = static_cast<SectionIndex>(section.size() - 1);
+        }
+
+        m_index.swap(index);
+        m_section.swap(section);
+        return true;
+    }
+
+    /*!
+     *  @brief  Ԃ
+     *  @param  sec 0̌oߕb
+     */
+    const Section& Lookup(int32_t sec) const
+    {
+        sec = std::max(0, std::min(sec, static_cast<int32_t>(SECONDS_OF_DAY) - 1));
+        return m_section[m_index[sec]];
+    }
+};
+
+StockTimeTableIndex::StockTimeTableIndex()
+: m_pImpl(new PIMPL())
+{
+}
+
+StockTimeTableIndex::~StockTimeTableIndex()
+{
+}
+
+/*!
+ *  @brief  \\z
+ *  @param  timetable       ^Ce[u(~)
+ *  @param  periodoftime    ԑы敪
+ *  @retval true            
+ */
+bool StockTimeTableIndex::Build(const std::vector<StockTimeTableUnit>& timetable,
+                                const std::vector<StockPeriodOfTimeUnit>& periodoftime)
+{
+    return m_pImpl->Build(timetable, periodoftime);
+}
+
+/*!
+ *  @brief  Ԃ
+ *  @param  sec 0̌oߕb
+ */
+const StockTimeTableIndex::Section& StockTimeTableIndex::Lookup(int32_t sec) const
+{
+    return m_pImpl->Lookup(sec);
+}
+
+} // namespace trading
@@ -0,0 +1,84 @@
+/*!
+ *  @file   stock_timetable_index.h
+ *  @brief  ^Ce[u/ԑы敪̕b\
+ *  @date   2018/01/29
+ *  @note   ^Ce[uƎԑы敪1(86400b)̕\ɓWJAt[̐`T\ɒu
+ */
+#pragma once
+
+#include "trade_define.h"
+#include "trade_struct.h"
+
+#include "hhmmss.h"
+
+#include <memory>
+#include <vector>
+
+namespace trading
+{
+
+/*!
+ *  @brief  ^Ce[u/ԑы敪̕b\
+ *  @note   0̌oߕbƂɁu̕bԁv̔ԍ(Ԃ͓eςbŋ؂)
+ */
+class StockTimeTableIndex
+{
+public:
+    enum
+    {
+        SECONDS_OF_DAY = 24*60*60,  //!< 1̕b
+    };
+
+    /*!
+     *  @brief  (eςȂAԑ)
+     */
+    struct Section
+    {
+        StockTimeTableUnit::eMode m_mode;       //!< TT[h
+        StockTimeTableUnit::eMode m_next_mode;  //!< TT[h
+        garnet::HHMMSS m_start;                 //!< TT[hn[b(ŏTTO000b)
+        eStockPeriodOfTime m_period;            //!< ԑы敪
+        int32_t m_next_trade_sec;               //!< ̔(/PTS)Jn(0̌oߕb/ȂȂ畉)
+        int32_t m_end_sec;                      //!< ԏI[(̕b玟̋/0̌oߕb)
+
+        Section()
+        : m_mode(StockTimeTableUnit::CLOSED)
+        , m_next_mode(StockTimeTableUnit::CLOSED)
+        , m_start()
+        , m_period(PERIOD_NONE)
+        , m_next_trade_sec(-1)
+        , m_end_sec(SECONDS_OF_DAY)
+        {
+        }
+    };
+
+    StockTimeTableIndex();
+    ~StockTimeTableIndex();
+
+    /*!
+     *  @brief  \\z
+     *  @param  timetable       ^Ce[u(~)
+     *  @param  periodoftime    ԑы敪
+     *  @retval true            
+     *  @note   TT[h́uݎOōłxTTvAԑы敪́un[`I[([܂)ɓŏ̋敪v
+     */
+    bool Build(const std::vector<StockTimeTableUnit>& timetable,
+               const std::vector<StockPeriodOfTimeUnit>& periodoftime);
+
+    /*!
+     *  @brief  Ԃ
+     *  @param  sec 0̌oߕb
+     *  @note   ͈͊O̕b͒[Ɋۂ߂
+     */
+    const Section& Lookup(int32_t sec) const;
+
+private:
+    StockTimeTableIndex(const StockTimeTableIndex&);
+    StockTimeTableIndex(StockTimeTableIndex&&);
+    StockTimeTableIndex& operator= (const StockTimeTableIndex&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
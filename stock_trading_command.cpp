@@ -56,6 +56,8 @@ StockTradingCommand::StockTradingCommand(eCommandType type,
 : m_type(type)
 , m_code(code.GetCode())
 , m_tactics_id(tactics_id)
+, m_trigger_stamp(0)
+, m_entry_stamp(0)
 {
 }
 
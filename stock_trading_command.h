@@ -123,6 +123,25 @@ public:
      */
     virtual void SetRepLevBargain(const garnet::YYMMDD& date, float64 value) {}
 
+    /*!
+     *  @brief  xvpݒ
+     *  @param  trigger_stamp   gK[Jn[}CNb]
+     *  @param  entry_stamp     ߓo^[}CNb]
+     */
+    void SetLatencyStamp(int64_t trigger_stamp, int64_t entry_stamp)
+    {
+        m_trigger_stamp = trigger_stamp;
+        m_entry_stamp = entry_stamp;
+    }
+    /*!
+     *  @brief  gK[Jn𓾂
+     */
+    int64_t GetTriggerStamp() const { return m_trigger_stamp; }
+    /*!
+     *  @brief  ߓo^𓾂
+     */
+    int64_t GetEntryStamp() const { return m_entry_stamp; }
+
     virtual ~StockTradingCommand() {};
 
 protected:
@@ -137,6 +156,8 @@ private:
     eCommandType m_type;    //!< ߎ
     uint32_t m_code;        //!< R[h
     int32_t m_tactics_id;   //!< 헪ID
+    int64_t m_trigger_stamp;//!< gK[Jn(xvp)
+    int64_t m_entry_stamp;  //!< ߓo^(xvp)
 
     StockTradingCommand(const StockTradingCommand&);
     StockTradingCommand(StockTradingCommand&&);
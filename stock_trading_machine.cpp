@@ -6,12 +6,23 @@
 #include "stock_trading_machine.h"
 #include "trade_debug.h"
 
+#include "allocation_tracker.h"
 #include "environment.h"
+#include "mpsc_queue.h"
+#include "scope_profiler.h"
 #include "securities_session_sbi.h"
+#include "server_clock.h"
+#include "stock_order_latency_tracer.h"
 #include "stock_ordering_manager.h"
+#include "stock_timetable_index.h"
 #include "stock_trading_starter_sbi.h"
+#include "thread_affinity.h"
+#include "timer_wheel.h"
 #include "trade_assistant_setting.h"
+#include "trade_datetime.h"
 #include "trade_struct.h"
+#include "trading_calendar.h"
+#include "update_jitter_meter.h"
 #include "update_message.h"
 
 #include "cipher_aes.h"
@@ -20,9 +31,12 @@
 #include "twitter/twitter_session.h"
 #include "utility/utility_datetime.h"
 #include "garnet_time.h"
+#include "yymmdd.h"
 
+#include <algorithm>
 #include <codecvt>
-#include <mutex>
+#include <deque>
+#include <thread>
 
 namespace trading
 {
@@ -44,8 +58,10 @@ private:
         SEQ_WAIT,               //!< Cӂ̃EFCg
     };
 
-    std::mutex m_mtx;       //!< rq
-    eSequence m_sequence;   //!< V[PX
+    MpscQueue<ResultMessage> m_result_queue;    //!< MʃL[(http֘AXbhUpdate)
+    std::function<void()> m_wakeup;             //!< Mʓʒm(Ă郋[vN)
+    TimerWheel m_timer;                         //!< (Ǘ҂ɂ݂̂Őɐ/ɔj)
+    eSequence m_sequence;                       //!< V[PX
 
     eSecuritiesType m_securities;                                   //!< ،Ў
     SecuritiesSessionPtr m_pSecSession;                             //!< ،ЂƂ̃ZbV
@@ -53,13 +69,18 @@ private:
     std::unique_ptr<garnet::GoogleCalendarAPI> m_pCalendarAPI;      //!< J_[API
     std::unique_ptr<StockTradingStarter> m_pStarter;                //!< X^[^[
     std::unique_ptr<StockOrderingManager> m_pOrderingManager;       //!< Ǘ
+    std::shared_ptr<StockOrderLatencyTracer> m_pLatencyTracer;      //!< oHxv
+    std::shared_ptr<ScopeProfiler> m_pProfiler;                     //!< Ԍv(DEBUG_SCOPE_PROFILER0Ȃ琶Ȃ)
+    std::shared_ptr<AllocationTracker> m_pAllocTracker;             //!< mیv(DEBUG_ALLOCATION_TRACKER0Ȃ琶Ȃ)
 
-    //!< JPXŗLxƓ(yjłȂƂx݂ɂȂ)
-    std::vector<garnet::MMDD> m_jpx_holiday;
+    //!< J_[(xf[^/JPXŗLxƓ)
+    TradingCalendar m_calendar;
     //!< ԑы敪
     std::vector<StockPeriodOfTimeUnit> m_periodoftime;
     //!< ^Ce[u
     std::vector<StockTimeTableUnit> m_timetable;
+    //!< ^Ce[u/ԑы敪̕b\
+    StockTimeTableIndex m_tt_index;
 
     garnet::RandomGenerator m_rand_gen;     //!< 
     garnet::CipherAES_string m_aes_uid;     //!< Íuid
@@ -67,23 +88,34 @@ private:
     garnet::CipherAES_string m_aes_pwd_sub; //!< Ípwd_sub
 
     int64_t m_tickcount;                        //!< O񑀍쎞tickCount
-    garnet::sTime m_last_sv_time;               //!< ŌɃT[o(،Ђыx)瓾
-    int64_t m_last_sv_time_tick;                //!< 𓾂tickCount
-    int64_t m_wait_count_ms;                    //!< EFCgJEg[~b]
+    ServerClock m_clock;                        //!< T[ov(،Ђ瓾ŕ␳)
+    UpdateJitterMeter m_jitter;                 //!< Update̗h炬v
+    TimerWheel::TimerID m_wait_timer;           //!< EFCg^C}[
     eSequence m_after_wait_seq;                 //!< EFCgJ̑JڐV[PX
     StockTimeTableUnit::eMode m_prev_tt_mode;   //!< OUpdate_MainTradeTimeTable[h
     garnet::sTime m_prev_fuzzy_time;            //!< OUpdate_MainTrade̎(t@W[)
     eStockPeriodOfTime m_prev_pot;              //!< OUpdate_MainTrade̊ԑы敪
-    int64_t m_last_monitoring_tick;             //!< ŌɊĎ(if[^)vtickCount
+    StockTimeTableIndex::Section m_section;     //!< ݂̃^Ce[u
+    TimerWheel::TimerID m_section_timer;        //!< Ԉ^C}[(܂ňȂ)
+    TimerWheel::TimerID m_monitoring_timer;     //!< Ď(if[^)vԊu^C}[(܂ŗvȂ)
     int64_t m_last_req_exec_info_tick;          //!< ŌɓvtickCount
+    TimerWheel::TimerID m_exec_info_timer;      //!< vԊu^C}[(܂ŗvȂ)
+    bool m_b_wait_exec_info;                    //!< OUpdate_MainTradeŖ}œ
+    TimerWheel::TimerID m_margin_timer;         //!< ]͍XV^C}[(܂Ŕ肵Ȃ)
+    std::deque<int64_t> m_periodic_req_tick;    //!< 1Ԃ̒v(if[^/)tickCount
     bool m_lock_update_margin;                  //!< ]͍XVbNtO
     bool m_lock_update_order;                   //!< bNtO(gup)
     bool m_reserve_output_log;                  //!< Oo͗\(gup)
+    int32_t m_prewarm_start_sec;                //!< ڑOmς܂Jn(0̌oߕb/ȂȂ畉)
 
     const int64_t m_monitoring_interval_ms;     //!< Ď(if[^)XVԊu[~b]
     const int64_t m_exec_info_interval_ms;      //!< XVԊu[~b]
+    const int64_t m_exec_info_active_interval_ms;   //!< XVԊu(ҋ@)[~b]
+    const size_t m_periodic_req_per_minute;     //!< v[/] (0Ȃ疳)
     const int64_t m_margin_interval_ms;         //!< ]͍XVԊu[~b]
     const std::string m_monitoring_log_dir;     //!< Ďo̓fBNg
+    const int32_t m_connection_prewarm_second;  //!< ڑOm[b](Jn̉bO)
+    const bool m_b_calendar_cross_check;        //!< xf[^ƃJ_[APIƍ邩
 
 private:
     PIMPL();
@@ -100,8 +132,14 @@ private:
     {
         m_sequence = SEQ_ERROR;
         //
-        if (!script_mng.BuildJPXHoliday(o_message, m_jpx_holiday)) {
-            return;
+        {
+            std::vector<garnet::MMDD> jpx_holiday;
+            if (!script_mng.BuildJPXHoliday(o_message, jpx_holiday)) {
+                return;
+            }
+            if (!m_calendar.Build(script_mng.GetTradingCalendarFile(), jpx_holiday, o_message)) {
+                return;
+            }
         }
         if (!script_mng.BuildStockPeriodOfTime(o_message, m_periodoftime)) {
             return;
@@ -117,6 +155,10 @@ private:
             {
                 return right < left;
             });
+        if (!m_tt_index.Build(m_timetable, m_periodoftime)) {
+            o_message.AddErrorMessage("too many timetable sections.");
+            return;
+        }
 
         // ،ЂƂ̏
         switch (m_securities)
@@ -136,65 +178,123 @@ private:
      */
     void Update_ClosedCheck(UpdateMessage& o_message)
     {
-        m_sequence = SEQ_WAIT;
-        m_wait_count_ms = 0;
+        m_sequence = SEQ_WAIT; // ʂ͂܂ő҂
 
         m_pSecSession->GetServerDateTime([this](const std::wstring& datetime) {
-            using namespace garnet;
-            // http֘AXbhĂ΂̂lock
-            std::lock_guard<std::mutex> lock(m_mtx);
-            //
-            UpdateServerTime(datetime);
+            // http֘AXbhĂ΂̂Updateŏ
+            PostResult([this, datetime]() {
+                using namespace garnet;
+                UpdateServerTime(datetime);
 
 #if !defined(DEBUG_SV_TIME_OVERRIDE) || (DEBUG_SV_TIME_OVERRIDE == 0)
-            const uint32_t ACCEPTABLE_DIFF_SECONDS = 10*60; // e鎞ԃY(10)
-            const uint32_t diff_sec
-                = utility_datetime::GetDiffSecondsFromLocalMachineTime(m_last_sv_time);
-            if (ACCEPTABLE_DIFF_SECONDS < diff_sec) {
-                // ԃYЂǂ]vȂƂ͂Aiɑ҂(ً}[h)
+                const uint32_t ACCEPTABLE_DIFF_SECONDS = 10*60; // e鎞ԃY(10)
+                const uint32_t diff_sec
+                    = utility_datetime::GetDiffSecondsFromLocalMachineTime(m_clock.GetLastServerTime());
+                if (ACCEPTABLE_DIFF_SECONDS < diff_sec) {
+                    // ԃYЂǂ]vȂƂ͂Aiɑ҂(ً}[h)
+                    return;
+                }
+#endif/* */
+
+                if (m_calendar.IsCovered(m_clock.GetLastServerTime())) {
+                    // xf[^͈͓̔Ȃ₢킹ɔ
+                    ApplyTradingCalendar();
+                    if (m_b_calendar_cross_check) {
+                        CrossCheckCalendar();
+                    }
+                    return;
+                }
+                m_pCalendarAPI->IsHoliday(m_clock.GetLastServerTime(), [this](bool b_result, bool is_holiday) {
+                    // http֘AXbhĂ΂̂Updateŏ
+                    PostResult([this, b_result, is_holiday]() {
+                        ApplyHolidayCheck(b_result, is_holiday);
+                    });
+                });
+            });
+        });
+    }
+
+    /*!
+     *  @brief  xf[^ɂ铌؋xꔻ
+     *  @note   xƓȂ玟̉cƓ(xf[^͈̔͊OȂ炻̍ŏ̓)ɍĒ
+     */
+    void ApplyTradingCalendar()
+    {
+        using namespace garnet;
+        sTime sv_time(m_clock.GetLastServerTime());
+        int32_t after_day = m_calendar.GetDaysToNextOpen(sv_time);
+
+#if defined(DEBUG_DISABLE_HOLIDAY) && (DEBUG_DISABLE_HOLIDAY != 0)
+        after_day = 0;
+#endif/* DEBUG_DISABLE_HOLIDAY */
+
+        m_after_wait_seq = SEQ_CLOSED_CHECK;
+        if (after_day > 0) {
+            StartWait(utility_datetime::GetAfterDayLimitMS(sv_time, after_day));
+        } else {
+            // cƓ  g[hCO
+            m_sequence = SEQ_PRE_TRADING;
+        }
+    }
+    /*!
+     *  @brief  xf[^ƃJ_[APȈƍ
+     *  @note   ʂ͑҂Ȃ(HĂʒm邾)
+     */
+    void CrossCheckCalendar()
+    {
+        const garnet::sTime& sv_time(m_clock.GetLastServerTime());
+        const bool b_holiday = m_calendar.IsHoliday(sv_time);
+        m_pCalendarAPI->IsHoliday(sv_time, [this, b_holiday](bool b_result, bool is_holiday) {
+            if (!b_result || is_holiday == b_holiday) {
                 return;
             }
-#endif/* */
+            // http֘AXbhĂ΂̂Updateŏ
+            PostResult([this]() {
+                m_pTwSession->Tweet(std::wstring(), L"xf[^ƃJ_[APǏʂHĂ܂");
+            });
+        });
+    }
 
-            m_pCalendarAPI->IsHoliday(m_last_sv_time, [this](bool b_result, bool is_holiday) {
-                // http֘AXbhĂ΂̂lock
-                std::lock_guard<std::mutex> lock(m_mtx);
-                //
-                garnet::sTime& sv_time(m_last_sv_time);
+    /*!
+     *  @brief  ؋x꒲ʓKp
+     *  @param  b_result    
+     *  @param  is_holiday  j
+     */
+    void ApplyHolidayCheck(bool b_result, bool is_holiday)
+    {
+        using namespace garnet;
+        sTime sv_time(m_clock.GetLastServerTime());
 
 #if defined(DEBUG_DISABLE_HOLIDAY) && (DEBUG_DISABLE_HOLIDAY != 0)
-                sv_time.tm_wday = 1;
-                is_holiday = false;
+        sv_time.tm_wday = 1;
+        is_holiday = false;
 #endif/* DEBUG_SV_TIME_OVERRIDE */
 
-                m_after_wait_seq = SEQ_CLOSED_CHECK;
+        m_after_wait_seq = SEQ_CLOSED_CHECK;
 
-                // yȂTɍĒ(ۂɊ֌WȂ)
-                if (utility_datetime::SATURDAY == sv_time.tm_wday) {
-                    const int32_t AFTER_DAY = 2;
-                    m_wait_count_ms = utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY);
-                } else if (utility_datetime::SUNDAY == sv_time.tm_wday) {
+        // yȂTɍĒ(ۂɊ֌WȂ)
+        if (utility_datetime::SATURDAY == sv_time.tm_wday) {
+            const int32_t AFTER_DAY = 2;
+            StartWait(utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY));
+        } else if (utility_datetime::SUNDAY == sv_time.tm_wday) {
+            const int32_t AFTER_DAY = 1;
+            StartWait(utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY));
+        } else {
+            if (b_result) {
+                if (is_holiday || m_calendar.IsJPXHoliday(sv_time)) {
+                    // j܂͌ŗLxƓ  Ē
                     const int32_t AFTER_DAY = 1;
-                    m_wait_count_ms = utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY);
+                    StartWait(utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY));
                 } else {
-                    if (b_result) {
-                        if (is_holiday || IsJPXHoliday(sv_time)) {
-                            // j܂͌ŗLxƓ  Ē
-                            const int32_t AFTER_DAY = 1;
-                            m_wait_count_ms
-                                = utility_datetime::GetAfterDayLimitMS(sv_time, AFTER_DAY);
-                        } else {
-                            // cƓ  g[hCO
-                            m_sequence = SEQ_PRE_TRADING;
-                        }
-                    } else {
-                        // s  10ɍă`W
-                        const int32_t WAIT_MINUTES = 10;
-                        m_wait_count_ms = utility_datetime::ToMiliSecondsFromMinute(WAIT_MINUTES);
-                    }
+                    // cƓ  g[hCO
+                    m_sequence = SEQ_PRE_TRADING;
                 }
-            });
-        });
+            } else {
+                // s  10ɍă`W
+                const int32_t WAIT_MINUTES = 10;
+                StartWait(utility_datetime::ToMiliSecondsFromMinute(WAIT_MINUTES));
+            }
+        }
     }
 
     /*!
@@ -206,12 +306,21 @@ private:
         m_sequence = SEQ_TRADING;
         m_prev_tt_mode = StockTimeTableUnit::CLOSED;
         m_prev_pot = PERIOD_NONE;
+        m_prev_fuzzy_time.tm_mday = 0;
+        m_timer.KillTimer(m_section_timer);
 
         switch (m_securities)
         {
         case SEC_SBI:
-            m_pStarter.reset(new StockTradingStarterSbi(m_pSecSession, m_pTwSession, script_mng));
-            m_pOrderingManager.reset(new StockOrderingManager(m_pSecSession, m_pTwSession, script_mng));
+            {
+                const PostResultFunc post_func = [this](const ResultMessage& result) {
+                    PostResult(result);
+                };
+                m_pStarter.reset(new StockTradingStarterSbi(m_pSecSession, m_pTwSession,
+                                                            post_func, script_mng));
+                m_pOrderingManager.reset(new StockOrderingManager(m_pSecSession, m_pTwSession,
+                                                                  post_func, m_timer, script_mng));
+            }
             break;
         default:
             break;
@@ -219,43 +328,38 @@ private:
     }
 
     /*!
-     *  @brief  ԑы敪
-     *  @param  now_tm      ݎ(t@W[)
+     *  @brief  ^Ce[uԍXV
+     *  @note   Ԃς1bO܂ł̓^C}[ɔCĈȂ(Ō1b͖)
+     *  @note   T[oXV^C}[j邱
      */
-    eStockPeriodOfTime DecideStockPeriodOfTime(const garnet::HHMMSS& now_tm)
+    void CorrectSection()
     {
-        for (const auto& pot : m_periodoftime) {
-            if (pot.m_start <= now_tm && now_tm <= pot.m_end) {
-                return pot.m_period;
-            }
+        if (m_timer.IsActive(m_section_timer)) {
+            return;
+        }
+        const int32_t now_sec = m_clock.GetSecondOfDay();
+        m_section = m_tt_index.Lookup(now_sec);
+        const int32_t remain_sec = m_section.m_end_sec - now_sec - 1;
+        if (remain_sec > 0) {
+            m_section_timer
+                = m_timer.SetTimer(garnet::utility_datetime::ToMiliSecondsFromSecond(remain_sec),
+                                   TimerWheel::Callback());
         }
-        return PERIOD_NONE;
     }
 
     /*!
      *  @brief  ^Ce[uXV
      *  @param  tickCount   oߎ[~b]
-     *  @param  now_tm      ݎ(t@W[)
      */
-    StockTimeTableUnit CorrectTimeTable(int64_t tickCount, const garnet::sTime& now_tm)
+    StockTimeTableUnit CorrectTimeTable(int64_t tickCount)
     {
         StockTimeTableUnit::eMode prev_mode = m_prev_tt_mode;
-        StockTimeTableUnit::eMode next_mode = StockTimeTableUnit::CLOSED;
-        StockTimeTableUnit now_tt(now_tm);
-        {
-            bool is_smallest = true;
-            for (const auto& tt : m_timetable) {
-                next_mode = now_tt.m_mode;
-                now_tt.m_mode = tt.m_mode;
-                if (tt < now_tt) {
-                    is_smallest = false;
-                    now_tt.m_hhmmss = tt.m_hhmmss;
-                    break;
-                }
-            }
-            if (is_smallest) {
-                now_tt.m_mode = StockTimeTableUnit::CLOSED;
-            }
+        StockTimeTableUnit::eMode next_mode = m_section.m_next_mode;
+        StockTimeTableUnit now_tt;
+        now_tt.m_hhmmss = m_clock.GetHHMMSS();
+        now_tt.m_mode = m_section.m_mode;
+        if (StockTimeTableUnit::CLOSED != now_tt.m_mode) {
+            now_tt.m_hhmmss = m_section.m_start;
         }
         bool b_valid = true;
         if (prev_mode != now_tt.m_mode) {
@@ -264,18 +368,14 @@ private:
                 auto initFunc = [this](eStockInvestmentsType investments_type,
                                        const StockBrandContainer& rcv_brand)->bool
                 {
-                    // http֘AXbhĂ΂̂lock
-                    std::lock_guard<std::mutex> lock(m_mtx);
-                    //
+                    // X^[^[MʃL[oR(Update)Ă
                     return m_pOrderingManager->InitMonitoringBrand(investments_type, rcv_brand);
                 };
                 auto updateFunc = [this](const SpotTradingsStockContainer& spot,
                                          const StockPositionContainer& position,
                                          const std::wstring& sv_date)
                 {
-                    // http֘AXbhĂ΂̂lock
-                    std::lock_guard<std::mutex> lock(m_mtx);
-                    //
+                    // X^[^[MʃL[oR(Update)Ă
                     UpdateServerTime(sv_date);
                     return m_pOrderingManager->UpdateHoldings(spot, position);
                 };
@@ -308,6 +408,76 @@ private:
             return StockTimeTableUnit();
         }
     }
+    /*!
+     *  @brief  JnO̐ڑOm
+     *  @note   ^Ce[u̎̔(/PTS)JnwbȓȂ1xڑ𒣂点
+     */
+    void PrewarmBeforeTradingWindow()
+    {
+        if (m_connection_prewarm_second <= 0) {
+            return;
+        }
+        const int32_t start_sec = m_section.m_next_trade_sec;
+        if (start_sec < 0) {
+            return;
+        }
+        const int32_t remain_sec = start_sec - m_clock.GetSecondOfDay();
+        if (remain_sec > 0 && remain_sec <= m_connection_prewarm_second) {
+            if (m_prewarm_start_sec != start_sec) {
+                m_prewarm_start_sec = start_sec;
+                m_pSecSession->PrewarmConnection();
+            }
+        }
+    }
+
+    /*!
+     *  @brief  vgg
+     *  @param  tickCount   oߎ[~b]
+     *  @retval true    vėǂ(g1)
+     *  @note   if[^ƓŘgL
+     */
+    bool ConsumePeriodicRequest(int64_t tickCount)
+    {
+        if (m_periodic_req_per_minute == 0) {
+            return true; // 
+        }
+        const int64_t window_ms = garnet::utility_datetime::ToMiliSecondsFromMinute(1);
+        while (!m_periodic_req_tick.empty() && (tickCount - m_periodic_req_tick.front()) >= window_ms) {
+            m_periodic_req_tick.pop_front();
+        }
+        if (m_periodic_req_tick.size() >= m_periodic_req_per_minute) {
+            return false;
+        }
+        m_periodic_req_tick.push_back(tickCount);
+        return true;
+    }
+
+    /*!
+     *  @brief  XVԊu𓾂
+     *  @note   ςݒ(s܂)Ԃ͒ZAȂ͒
+     */
+    int64_t GetExecInfoInterval() const
+    {
+        if (m_pOrderingManager->IsInWaitExecInfo()) {
+            return std::min(m_exec_info_active_interval_ms, m_exec_info_interval_ms);
+        }
+        return m_exec_info_interval_ms;
+    }
+    /*!
+     *  @brief  XVԊu̐؂ւ
+     *  @param  tickCount   oߎ[~b]
+     *  @note   }œȂAvԊu^C}[Z̊ԊuŐ
+     */
+    void UpdateExecInfoInterval(int64_t tickCount)
+    {
+        const bool b_wait_exec_info = m_pOrderingManager->IsInWaitExecInfo();
+        if (b_wait_exec_info && !m_b_wait_exec_info) {
+            const int64_t past_ms = tickCount - m_last_req_exec_info_tick;
+            m_timer.ResetTimer(m_exec_info_timer, GetExecInfoInterval() - past_ms);
+        }
+        m_b_wait_exec_info = b_wait_exec_info;
+    }
+
     /*!
      *  @brief  XVFg[h又
      *  @param[in]  tickCount   oߎ[~b]
@@ -316,20 +486,21 @@ private:
      */
     void Update_MainTrade(int64_t tickCount, TradeAssistantSetting& script_mng, UpdateMessage& o_message)
     {
-        // T[o^CɃ[J̌oߎԂt@W[Ȍݎ
-        garnet::sTime now_tm;
-        const int64_t diff_tick = tickCount-m_last_sv_time_tick;
-        garnet::utility_datetime::AddTimeAndDiffMS(m_last_sv_time, diff_tick, now_tm);
-        if (m_prev_fuzzy_time.tm_mday != 0 &&
-            m_prev_fuzzy_time.tm_mday != m_last_sv_time.tm_mday) {
+        TRADE_PROFILE_SCOPE(PHASE_MAIN_TRADE);
+        // T[o^CɃ[J̌oߎԂt@W[Ȍݎ(t[Ƃ1x)
+        m_clock.Advance(tickCount);
+        const garnet::sTime& now_tm(m_clock.GetTime());
+        const bool b_day_changed = (m_prev_fuzzy_time.tm_mday != 0 &&
+                                    m_prev_fuzzy_time.tm_mday != now_tm.tm_mday);
+        m_prev_fuzzy_time = now_tm;
+        if (b_day_changed) {
             // tςֈڍs
             m_sequence = SEQ_DAILY_PROCESS;
             return;
-        } else {
-            m_prev_fuzzy_time = now_tm;
         }
         //
-        const auto pot = DecideStockPeriodOfTime(now_tm);
+        CorrectSection();
+        const auto pot = m_section.m_period;
         if (m_prev_pot == PERIOD_DAYTIME && pot == PERIOD_NIGHTTIME) {
             // fC^CiCg^Cɐ؂ւd؂蒼
             m_sequence = SEQ_DAILY_PROCESS;
@@ -337,7 +508,7 @@ private:
             return;
         }
         //
-        auto now_tt(std::move(CorrectTimeTable(tickCount, now_tm)));
+        auto now_tt(std::move(CorrectTimeTable(tickCount)));
         auto now_mode = now_tt.m_mode;
 
         if (StockTimeTableUnit::TOKYO == now_mode || StockTimeTableUnit::PTS == now_mode) {
@@ -345,67 +516,86 @@ private:
                 = StockTimeTableUnit::ToInvestmentsTypeFromMode(now_mode);
             if (m_pStarter->IsReady()) {
                 // ĎXV
-                if ((tickCount - m_last_monitoring_tick) > m_monitoring_interval_ms) {
-                    m_last_monitoring_tick = tickCount;
+                if (!m_timer.IsActive(m_monitoring_timer) &&
+                    ConsumePeriodicRequest(tickCount)) {
+                    m_monitoring_timer = m_timer.SetTimer(m_monitoring_interval_ms,
+                                                          TimerWheel::Callback());
                     m_pSecSession->UpdateValueData(
                         [this, investments_type]
                             (bool b_success, const std::vector<RcvStockValueData>& rcv_valuedata,
                                              const std::wstring& sv_date) {
-                        if (!b_success) { return; }
-                        // http֘AXbhĂ΂̂lock
-                        std::lock_guard<std::mutex> lock(m_mtx); 
-                        // V[PXJڂĂ疳(ی)
-                        if (m_sequence == SEQ_TRADING) {
-                            m_pOrderingManager->UpdateValueData(investments_type,
-                                                                sv_date,
-                                                                rcv_valuedata);
-                        }
+                        // s or OƓe(lȂ)Ȃ牽Ȃ
+                        if (!b_success || rcv_valuedata.empty()) { return; }
+                        // http֘AXbhĂ΂̂Updateŏ
+                        PostResult([this, investments_type, rcv_valuedata, sv_date]() {
+                            // V[PXJڂĂ疳(ی)
+                            if (m_sequence == SEQ_TRADING) {
+                                m_pOrderingManager->UpdateValueData(investments_type,
+                                                                    sv_date,
+                                                                    rcv_valuedata);
+                            }
+                        });
                     });
                 }
                 // XV
-                if ((tickCount - m_last_req_exec_info_tick) > m_exec_info_interval_ms) {
+                UpdateExecInfoInterval(tickCount);
+                if (!m_timer.IsActive(m_exec_info_timer) &&
+                    ConsumePeriodicRequest(tickCount)) {
                     m_last_req_exec_info_tick = tickCount;
+                    m_exec_info_timer = m_timer.SetTimer(GetExecInfoInterval(),
+                                                         TimerWheel::Callback());
                     m_pSecSession->UpdateExecuteInfo(
                         [this](bool b_success,
                                const std::vector<StockExecInfoAtOrder>& rcv_info) {
                         if (!b_success) { return; }
-                        // http֘AXbhĂ΂̂lock
-                        std::lock_guard<std::mutex> lock(m_mtx);
-                        //
-                        if (m_sequence == SEQ_TRADING) {
-                            m_pOrderingManager->UpdateExecInfo(rcv_info);
-                        }
+                        // http֘AXbhĂ΂̂Updateŏ
+                        PostResult([this, rcv_info]() {
+                            if (m_sequence == SEQ_TRADING) {
+                                m_pOrderingManager->UpdateExecInfo(rcv_info);
+                            }
+                        });
                     });
                 }
                 // ]͍XV(ZbVێړI)
-                if (!m_lock_update_margin) {
-                    if ((tickCount - m_pSecSession->GetLastAccessTime()) > m_margin_interval_ms) {
+                if (!m_lock_update_margin && !m_timer.IsActive(m_margin_timer)) {
+                    const int64_t idle_ms = tickCount - m_pSecSession->GetLastAccessTime();
+                    if (idle_ms <= m_margin_interval_ms) {
+                        // ̗vŐڑgĂԂ͔摗
+                        m_margin_timer = m_timer.SetTimer(m_margin_interval_ms - idle_ms + 1,
+                                                          TimerWheel::Callback());
+                    } else {
                         m_lock_update_margin = true;
                         m_pSecSession->UpdateMargin([this](bool b_result) {
-                            // http֘AXbhĂ΂̂lock
-                            std::lock_guard<std::mutex> lock(m_mtx);
-                            //
-                            if (b_result) {
-                                m_lock_update_margin = false;
-                            } else {
-                                m_pTwSession->Tweet(std::wstring(),
-                                                    L"،TCgƂ̐ڑ؂܂");
-                            }
+                            // http֘AXbhĂ΂̂Updateŏ
+                            PostResult([this, b_result]() {
+                                if (b_result) {
+                                    m_lock_update_margin = false;
+                                } else {
+                                    m_pTwSession->Tweet(std::wstring(),
+                                                        L"،TCgƂ̐ڑ؂܂");
+                                }
+                            });
                         });
                     }
                 }
                 // ǗXV
                 if (!m_lock_update_order) {
-                    m_pOrderingManager->Update(tickCount, now_tm, now_tt.m_hhmmss,
+                    m_pOrderingManager->Update(tickCount, m_clock.GetHHMMSS(), now_tt.m_hhmmss,
                                                investments_type, m_aes_pwd_sub, script_mng);
                 }
                 // ԑы敪ʒm
                 m_pOrderingManager->TellPeriodOfTime(pot);
             }
+            m_prewarm_start_sec = -1;
         } else {
+            // JnOɐڑ𒣂Ă
+            PrewarmBeforeTradingWindow();
             if (m_reserve_output_log) {
                 m_reserve_output_log = false;
-                m_pOrderingManager->OutputMonitoringLog(m_monitoring_log_dir, m_last_sv_time);
+                m_pOrderingManager->OutputMonitoringLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+                m_pSecSession->OutputConnectionLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+                m_pSecSession->OutputParserLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+                OutputUpdateLog();
             }
         }
 
@@ -413,6 +603,33 @@ private:
         m_prev_pot = pot;
     }
 
+    /*!
+     *  @brief  Update̗h炬Wv/Ԍv/mیvo
+     */
+    void OutputUpdateLog() const
+    {
+        const garnet::YYMMDD date(m_clock.GetLastServerTime());
+        // t@Co͂͏d̂ŕʃXbh(h炬Wv͂ŎʂĂ)
+        UpdateJitterMeter::Statistics jitter;
+        m_jitter.GetStatistics(jitter);
+        const std::string log_dir(m_monitoring_log_dir);
+        const std::string date_str(date.to_string());
+        const bool b_profiler = (m_pProfiler != nullptr);
+        const bool b_alloc_tracker = (m_pAllocTracker != nullptr);
+        std::thread t([log_dir, date_str, jitter, b_profiler, b_alloc_tracker]()
+        {
+            thread_affinity::ApplyCurrentThread(thread_affinity::ROLE_WORKER);
+            UpdateJitterMeter::OutputStatistics(jitter, log_dir + "update_jitter_" + date_str + ".csv");
+            if (b_profiler) {
+                ScopeProfiler::OutputLog(log_dir, date_str);
+            }
+            if (b_alloc_tracker) {
+                AllocationTracker::OutputLog(log_dir + "allocation_" + date_str + ".csv");
+            }
+        });
+        t.detach();
+    }
+
     /*!
      *  @brief  XVF
      */
@@ -420,64 +637,96 @@ private:
     {
         if (!m_pOrderingManager->IsInWaitMessageFromSecurities()) {
             // Ǘ҂،TCgƒʐMłȂȂ烍Ooċx`FbN
-            m_pOrderingManager->OutputMonitoringLog(m_monitoring_log_dir, m_last_sv_time);
+            m_pOrderingManager->OutputMonitoringLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+            m_pSecSession->OutputConnectionLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+            m_pSecSession->OutputParserLog(m_monitoring_log_dir, m_clock.GetLastServerTime());
+            OutputUpdateLog();
             m_sequence = SEQ_CLOSED_CHECK;
         }
     }
 
     /*!
-     *  @brief  XVFėpEFCg
-     *  @param  tickCount   oߎ[~b]
+     *  @brief  ėpEFCgJn
+     *  @param  wait_ms EFCg[~b]
+     *  @note   m_after_wait_seq֑Jڂ
+     *  @note   EFCg(SEQ_WAIT)UpdateŉȂ(^C}[ɔC)
      */
-    void Update_Wait(int64_t tickCount)
+    void StartWait(int64_t wait_ms)
     {
-        if (m_wait_count_ms > 0) {
-            const int64_t past_tick = tickCount - m_tickcount;
-            if (past_tick >= m_wait_count_ms) {
-                m_wait_count_ms = 0;
-                m_sequence = m_after_wait_seq;
-            } else {
-                m_wait_count_ms -= past_tick;
-            }
-        }
+        m_sequence = SEQ_WAIT;
+        m_timer.KillTimer(m_wait_timer);
+        m_wait_timer = m_timer.SetTimer(wait_ms, [this](int64_t) {
+            m_sequence = m_after_wait_seq;
+        });
     }
 
 
+    /*!
+     *  @brief  Mʓ
+     *  @param  result  M(Me͒lŃLv`Ă)
+     *  @note   http֘AXbhĂ΂(lockȂ)
+     */
+    void PostResult(const ResultMessage& result)
+    {
+        m_result_queue.Push(result);
+        if (m_wakeup) {
+            m_wakeup();
+        }
+    }
+    /*!
+     *  @brief  Mʓʒmݒ
+     *  @param  handler ʒm(http֘AXbhĂ΂)
+     */
+    void SetWakeUpHandler(const std::function<void()>& handler)
+    {
+        m_wakeup = handler;
+    }
+    /*!
+     *  @brief  UpdateKvȎ𓾂
+     *  @note   (^C}[)̍ł
+     */
+    int64_t GetNextUpdateTick() const
+    {
+        return m_timer.GetNextExpireTick();
+    }
+    /*!
+     *  @brief  MʓKp
+     *  @note   Update`œ͂Ă镪Sď
+     *  @note   Kpɓꂽ()ď
+     */
+    void ApplyResult()
+    {
+        TRADE_PROFILE_SCOPE(PHASE_APPLY_RESULT);
+        ResultMessage result;
+        while (m_result_queue.Pop(result)) {
+            TRADE_ALLOCATION_SCOPE(SECTION_APPLY_RESULT);
+            result();
+        }
+    }
+
     /*!
      *  @brief  T[oXV
      *  @param  datetime    T[o(RFC1123`)
      */
     void UpdateServerTime(const std::wstring& datetime)
     {
-        auto pt(std::move(garnet::utility_datetime::ToLocalTimeFromRFC1123(datetime)));
-        garnet::utility_datetime::ToTimeFromBoostPosixTime(pt, m_last_sv_time);
-        m_last_sv_time_tick = garnet::utility_datetime::GetTickCountGeneral();
+        garnet::sTime sv_time;
+        memset(reinterpret_cast<void*>(&sv_time), 0, sizeof(sv_time));
+        trade_datetime::ToLocalTimeFromRFC1123(datetime, sv_time);
 
 #if defined(DEBUG_SV_TIME_OVERRIDE) && (DEBUG_SV_TIME_OVERRIDE != 0)
         static int32_t ov_count = 2;
         if (ov_count > 0) {
-            m_last_sv_time.tm_hour =  9;
-            m_last_sv_time.tm_min  = 19;
-            m_last_sv_time.tm_sec  = 25;
+            sv_time.tm_hour =  9;
+            sv_time.tm_min  = 19;
+            sv_time.tm_sec  = 25;
             ov_count--;
         }
 #endif/* DEBUG_SV_TIME_OVERRIDE */
-    }
 
-    /*!
-     *  @brief  JPX̌ŗLxƓ
-     *  @param  src ׂ
-     *  @retval true    xƓ
-     */
-    bool IsJPXHoliday(const garnet::sTime& src) const
-    {
-        const garnet::MMDD srcmmdd(src);
-        for (const auto& mmdd: m_jpx_holiday) {
-            if (mmdd == srcmmdd) {
-                return true;
-            }
-        }
-        return false;
+        m_clock.Correct(sv_time, garnet::utility_datetime::GetTickCountGeneral());
+        // t@W[Ԃ̂ŋԂ
+        m_timer.KillTimer(m_section_timer);
     }
 
 public:
@@ -487,7 +736,9 @@ public:
      */
     PIMPL(const TradeAssistantSetting& script_mng,
           const garnet::TwitterSessionForAuthorPtr& tw_session)
-    : m_mtx()
+    : m_result_queue()
+    , m_wakeup()
+    , m_timer()
     , m_sequence(SEQ_INITIALIZE)
     , m_securities(script_mng.GetSecuritiesType())
     , m_pSecSession()
@@ -495,37 +746,60 @@ public:
     , m_pCalendarAPI(new garnet::GoogleCalendarAPI(Environment::GetGoogleCarendarAPIConfig()))
     , m_pStarter()
     , m_pOrderingManager()
-    , m_jpx_holiday()
+    , m_pLatencyTracer(StockOrderLatencyTracer::Create())
+    , m_pProfiler()
+    , m_pAllocTracker()
+    , m_calendar()
     , m_periodoftime()
     , m_timetable()
+    , m_tt_index()
     , m_rand_gen()
     , m_aes_uid()
     , m_aes_pwd()
     , m_aes_pwd_sub()
     , m_tickcount(0)
-    , m_last_sv_time()
-    , m_last_sv_time_tick(0)
-    , m_wait_count_ms(0)
+    , m_clock()
+    , m_jitter()
+    , m_wait_timer(TimerWheel::INVALID_ID)
     , m_after_wait_seq(SEQ_ERROR)
     , m_prev_tt_mode(StockTimeTableUnit::CLOSED)
     , m_prev_pot(PERIOD_NONE)
-    , m_last_monitoring_tick(0)
+    , m_section()
+    , m_section_timer(TimerWheel::INVALID_ID)
+    , m_monitoring_timer(TimerWheel::INVALID_ID)
     , m_last_req_exec_info_tick(0)
+    , m_exec_info_timer(TimerWheel::INVALID_ID)
+    , m_b_wait_exec_info(false)
+    , m_margin_timer(TimerWheel::INVALID_ID)
+    , m_periodic_req_tick()
     , m_lock_update_margin(false)
     , m_lock_update_order(false)
     , m_reserve_output_log(false)
+    , m_prewarm_start_sec(-1)
     , m_monitoring_interval_ms(
         garnet::utility_datetime::ToMiliSecondsFromSecond(
             script_mng.GetStockMonitoringIntervalSecond()))
     , m_exec_info_interval_ms(
         garnet::utility_datetime::ToMiliSecondsFromSecond(
             script_mng.GetStockExecInfoIntervalSecond()))
+    , m_exec_info_active_interval_ms(
+        garnet::utility_datetime::ToMiliSecondsFromSecond(
+            script_mng.GetStockExecInfoActiveIntervalSecond()))
+    , m_periodic_req_per_minute(static_cast<size_t>(std::max(0, script_mng.GetSecuritiesRequestPerMinute())))
     , m_margin_interval_ms(
         garnet::utility_datetime::ToMiliSecondsFromMinute(
             script_mng.GetSessionKeepMinute())/2) // ZbVێړIȂ̂ŃZbV^C̔炢
     , m_monitoring_log_dir(std::move(script_mng.GetStockMonitoringLogDir()))
+    , m_connection_prewarm_second(script_mng.GetConnectionPrewarmSecond())
+    , m_b_calendar_cross_check(script_mng.GetTradingCalendarCrossCheck() != 0)
     {
-        memset(reinterpret_cast<void*>(&m_last_sv_time), 0, sizeof(m_last_sv_time));
+        memset(reinterpret_cast<void*>(&m_prev_fuzzy_time), 0, sizeof(m_prev_fuzzy_time));
+#if defined(DEBUG_SCOPE_PROFILER) && (DEBUG_SCOPE_PROFILER != 0)
+        m_pProfiler = ScopeProfiler::Create();
+#endif/* DEBUG_SCOPE_PROFILER */
+#if defined(DEBUG_ALLOCATION_TRACKER) && (DEBUG_ALLOCATION_TRACKER != 0)
+        m_pAllocTracker = AllocationTracker::Create();
+#endif/* DEBUG_ALLOCATION_TRACKER */
     }
 
     /*!
@@ -578,7 +852,13 @@ public:
      */
     void Update(int64_t tickCount, TradeAssistantSetting& script_mng,  UpdateMessage& o_message)
     {
-        std::lock_guard<std::mutex> lock(m_mtx); // Update͎M荞݋֎~
+        m_jitter.Begin();
+        TRADE_PROFILE_SCOPE(PHASE_UPDATE);
+        TRADE_ALLOCATION_SCOPE(SECTION_UPDATE);
+        // OUpdateȍ~ɓ͂MʂKp(Ԃ͂̃XbhłGȂ)
+        ApplyResult();
+        // }^C}[
+        m_timer.Advance(tickCount);
 
         switch(m_sequence)
         {
@@ -600,12 +880,13 @@ public:
             break;
 
         case SEQ_WAIT:
-            Update_Wait(tickCount);
+            // ̓^C}[ŏ
         default:
             break;
         }
 
         m_tickcount = tickCount;
+        m_jitter.End();
     }
 };
 
@@ -672,4 +953,22 @@ void StockTradingMachine::Update(int64_t tickCount, TradeAssistantSetting& scrip
     m_pImpl->Update(tickCount, script_mng, o_message);
 }
 
+/*!
+ *  @brief  UpdateKvȎ𓾂
+ *  @return tickCount(sȂ-1)
+ */
+int64_t StockTradingMachine::GetNextUpdateTick() const
+{
+    return m_pImpl->GetNextUpdateTick();
+}
+
+/*!
+ *  @brief  Mʓʒmݒ
+ *  @param  handler ʒm(http֘AXbhĂ΂)
+ */
+void StockTradingMachine::SetWakeUpHandler(const std::function<void()>& handler)
+{
+    m_pImpl->SetWakeUpHandler(handler);
+}
+
 } // namespace trading
@@ -64,6 +64,17 @@ public:
                 TradeAssistantSetting& script_mng,
                 UpdateMessage& o_message) override;
 
+    /*!
+     *  @brief  UpdateKvȎ𓾂
+     *  @return tickCount(sȂ-1)
+     */
+    int64_t GetNextUpdateTick() const override;
+    /*!
+     *  @brief  Mʓʒmݒ
+     *  @param  handler ʒm(http֘AXbhĂ΂)
+     */
+    void SetWakeUpHandler(const std::function<void()>& handler) override;
+
 private:
     StockTradingMachine();
 
@@ -31,6 +31,8 @@ private:
     SecuritiesSessionPtr m_pSecSession;
     //!< twitterƂ̃ZbV(bZ[Wʒmp)
     garnet::TwitterSessionForAuthorPtr m_pTwSession;
+    //!< Mʓ֐(http֘AXbh̎Mʂ𔄔Xbhŏ)
+    PostResultFunc m_post_func;
 
     eSequence m_sequence;                                   //!< V[PX
     eStockInvestmentsType m_last_register_investments;      //!< ŌɊĎo^
@@ -46,11 +48,13 @@ private:
                                                      const StockPositionContainer& position,
                                                      const std::wstring& sv_date)
         {
-            if (b_result) {
-                m_sequence = SEQ_READY;
-                update_func(spot, position, sv_date);
-            }
-            // sꍇBUSŶ܂(X^[^[ĂяoőΏ)
+            m_post_func([this, update_func, b_result, spot, position, sv_date]() {
+                if (b_result) {
+                    m_sequence = SEQ_READY;
+                    update_func(spot, position, sv_date);
+                }
+                // sꍇBUSŶ܂(X^[^[ĂяoőΏ)
+            });
         });
         m_sequence = SEQ_BUSY;
      }
@@ -77,10 +81,12 @@ private:
                                                      update_func]
                                               (bool b_result, const StockBrandContainer& rcv_brand)
         {
-            if (b_result && init_func(investments_type, rcv_brand)) {
-                GetStockOwned(update_func);
-            }
-            // sꍇBUSŶ܂(X^[^[ĂяoőΏ)
+            m_post_func([this, investments_type, init_func, update_func, b_result, rcv_brand]() {
+                if (b_result && init_func(investments_type, rcv_brand)) {
+                    GetStockOwned(update_func);
+                }
+                // sꍇBUSŶ܂(X^[^[ĂяoőΏ)
+            });
         });
         m_last_register_investments = investments_type;
         m_sequence = SEQ_BUSY;
@@ -90,14 +96,17 @@ public:
     /*!
      *  @param  sec_session ،ЂƂ̃ZbV
      *  @param  tw_session  twitterƂ̃ZbV
+     *  @param  post_func   Mʓ֐
      *  @param  script_mng  Oݒ(XNvg)Ǘ
      */
     PIMPL(const SecuritiesSessionPtr& sec_session,
           const garnet::TwitterSessionForAuthorPtr& tw_session,
+          const PostResultFunc& post_func,
           const TradeAssistantSetting& script_mng)
     : m_session_keep_ms(garnet::utility_datetime::ToMiliSecondsFromMinute(script_mng.GetSessionKeepMinute()))
     , m_pSecSession(sec_session)
     , m_pTwSession(tw_session)
+    , m_post_func(post_func)
     , m_sequence(SEQ_NONE)
     , m_last_register_investments(INVESTMENTS_NONE)
     {
@@ -147,22 +156,26 @@ public:
                                   (bool b_result, bool b_login, bool b_important_msg,
                                    const std::wstring& sv_date)
             {
-                if (!b_result) {
-                    m_pTwSession->Tweet(sv_date, L"OCG[Bً}eiX܂B");
-                } else if (!b_login) {
-                    m_pTwSession->Tweet(sv_date, L"OCł܂łBID܂̓pX[hႢ܂B");
-                    // >ToDo< ē͂ł悤ɂ(g[hJn{^AmachineV[PXZbg)
-                } else {
-                    if (b_important_msg) {
-                        m_pTwSession->Tweet(sv_date, L"OC܂BSBȈdvȂm点܂B");
+                m_post_func([this, monitoring_code, investments_type,
+                             update_func, init_func,
+                             b_result, b_login, b_important_msg, sv_date]() {
+                    if (!b_result) {
+                        m_pTwSession->Tweet(sv_date, L"OCG[Bً}eiX܂B");
+                    } else if (!b_login) {
+                        m_pTwSession->Tweet(sv_date, L"OCł܂łBID܂̓pX[hႢ܂B");
+                        // >ToDo< ē͂ł悤ɂ(g[hJn{^AmachineV[PXZbg)
                     } else {
-                        m_pTwSession->Tweet(sv_date, L"OC܂");
+                        if (b_important_msg) {
+                            m_pTwSession->Tweet(sv_date, L"OC܂BSBȈdvȂm点܂B");
+                        } else {
+                            m_pTwSession->Tweet(sv_date, L"OC܂");
+                        }
+                        // Ďo^
+                        RegisterMonitoringCode(monitoring_code,
+                                               investments_type,
+                                               init_func, update_func);
                     }
-                    // Ďo^
-                    RegisterMonitoringCode(monitoring_code,
-                                           investments_type,
-                                           init_func, update_func);
-                }
+                });
             });
             m_sequence = SEQ_BUSY;
         } else {
@@ -175,13 +188,15 @@ public:
 /*!
  *  @param  sec_session ،ЂƂ̃ZbV
  *  @param  tw_session  twitterƂ̃ZbV
+ *  @param  post_func   Mʓ֐
  *  @param  script_mng  Oݒ(XNvg)Ǘ
  */
 StockTradingStarterSbi::StockTradingStarterSbi(const SecuritiesSessionPtr& sec_session,
                                                const garnet::TwitterSessionForAuthorPtr& tw_session,
+                                               const PostResultFunc& post_func,
                                                const TradeAssistantSetting& script_mng)
 : StockTradingStarter()
-, m_pImpl(new PIMPL(sec_session, tw_session, script_mng))
+, m_pImpl(new PIMPL(sec_session, tw_session, post_func, script_mng))
 {
 }
 /*!
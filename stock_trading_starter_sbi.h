@@ -7,6 +7,7 @@
 #pragma once
 
 #include "stock_trading_starter.h"
+#include "mpsc_queue.h"
 #include "securities_session_fwd.h"
 
 #include "twitter/twitter_session_fwd.h"
@@ -23,10 +24,13 @@ public:
     /*!
      *  @param  sec_session ،ЂƂ̃ZbV
      *  @param  tw_session  twitterƂ̃ZbV
+     *  @param  post_func   Mʓ֐
      *  @param  script_mng  Oݒ(XNvg)Ǘ
+     *  @note   ،Ђ̎Mʂpost_funcŔXbhɓnĂ珈
      */
     StockTradingStarterSbi(const SecuritiesSessionPtr& sec_session,
                            const garnet::TwitterSessionForAuthorPtr& tw_session,
+                           const PostResultFunc& post_func,
                            const TradeAssistantSetting& script_mng);
     /*!
      */
@@ -9,6 +9,7 @@
 #include "stock_trading_command.h"
 #include "stock_trading_tactics_utility.h"
 #include "trade_assistant_setting.h"
+#include "trade_struct.h"
 
 #include <algorithm>
 
@@ -62,6 +63,44 @@ bool StockTradingTactics::Trigger::Judge(const garnet::HHMMSS& now_time,
                                          const garnet::HHMMSS& sec_time,
                                          const StockValueData& valuedata,
                                          TradeAssistantSetting& script_mng) const
+{
+    return JudgeCore(now_time, sec_time, valuedata, script_mng, 0.0);
+}
+/*!
+ *  @brief  ڋߔ
+ *  @param  now_time    ݎb
+ *  @param  sec_time    ZNVJn
+ *  @param  valuedata   if[^(1)
+ *  @param  script_mng  Oݒ(XNvg)Ǘ
+ *  @param  distance    ڋߗ[%]
+ *  @note   ڋߗ̓gK[_̑΋(_̉%O)őSʋ
+ */
+bool StockTradingTactics::Trigger::JudgeNear(const garnet::HHMMSS& now_time,
+                                             const garnet::HHMMSS& sec_time,
+                                             const StockValueData& valuedata,
+                                             TradeAssistantSetting& script_mng,
+                                             float32 distance) const
+{
+    if (distance <= 0.f || distance >= 100.f) {
+        return false; // 100%ȏ͐_0(܂͂z)ɂȂ̂Ŕ肵Ȃ
+    }
+    return JudgeCore(now_time, sec_time, valuedata, script_mng, distance/100.0);
+}
+
+/*!
+ *  @brief  ({)
+ *  @param  now_time    ݎb
+ *  @param  sec_time    ZNVJn
+ *  @param  valuedata   if[^(1)
+ *  @param  script_mng  Oݒ(XNvg)Ǘ
+ *  @param  near_rate   ڋߗ(0Ȃʏ픻)
+ *  @note   ϑl_Tɑ΂ T*(1-near_rate) ܂ŗĂΐƂ݂Ȃ
+ */
+bool StockTradingTactics::Trigger::JudgeCore(const garnet::HHMMSS& now_time,
+                                             const garnet::HHMMSS& sec_time,
+                                             const StockValueData& valuedata,
+                                             TradeAssistantSetting& script_mng,
+                                             float64 near_rate) const
 {
     if (valuedata.m_value_data.empty()) {
         return false; // if[^Ȃ画肵Ȃ
@@ -107,12 +146,14 @@ bool StockTradingTactics::Trigger::Judge(const garnet::HHMMSS& now_time,
             }
             // Ԏnl݂ꍇ̂݃Mbv𒲂ׂ
             if (v_open > 0.f) {
+                // _([%])̑΋
+                const float64 threshold = m_float_param*(1.0 - near_rate);
                 if (m_float_param > 0.f) {
                     const float64 rateU = ((v_high-v_open)/v_open)*100.f;
-                    return rateU >= m_float_param; 
+                    return rateU >= threshold; 
                 } else {
                     const float64 rateD = ((v_low-v_open)/v_open)*100.f;
-                    return rateD <= m_float_param;
+                    return rateD <= threshold;
                 }
             }
         }
@@ -124,7 +165,8 @@ bool StockTradingTactics::Trigger::Judge(const garnet::HHMMSS& now_time,
             const int32_t sectsec = sec_time.GetPastSecond();
             const int32_t latestsec = valuedata.m_value_data.back().m_hhmmss.GetPastSecond();
             const int32_t diffsec = pastsec - std::max(sectsec, latestsec);
-            return diffsec >= m_signed_param;
+            // _(b)̑΋(bPʂɊۂ߂Ȃ)
+            return static_cast<float64>(diffsec) >= static_cast<float64>(m_signed_param)*(1.0 - near_rate);
         }
         break;
 
@@ -134,6 +176,24 @@ bool StockTradingTactics::Trigger::Judge(const garnet::HHMMSS& now_time,
             // oȂ(f[^擪̂ݎԋL^pɑ݂)ł肷
             // value/hight/low͖擾Ȃ̂͊֐ŒeƂɂ
             float64 lvalue = latest.m_value;
+            if (near_rate > 0.0) {
+                if (lvalue <= 0.0) {
+                    return false; // Ȃڋߔ肵Ȃ
+                }
+                // _(i)̑΋
+                // _P̏㉺ǂ炩߂ÂĂ邩Ȃ̂
+                // l=P*(1-near_rate)/P*(1+near_rate)ƂȂP̗Ŕ肷
+                return script_mng.CallJudgeFunction(m_signed_param,
+                                                    lvalue/(1.0 - near_rate),
+                                                    valuedata.m_high,
+                                                    valuedata.m_low,
+                                                    valuedata.m_close) ||
+                       script_mng.CallJudgeFunction(m_signed_param,
+                                                    lvalue/(1.0 + near_rate),
+                                                    valuedata.m_high,
+                                                    valuedata.m_low,
+                                                    valuedata.m_close);
+            }
             return script_mng.CallJudgeFunction(m_signed_param,
                                                 lvalue,
                                                 valuedata.m_high,
@@ -255,4 +315,68 @@ void StockTradingTactics::Interpret(eStockInvestmentsType investments,
     }
 }
 
+/*!
+ *  @brief  gK[ڋߒ
+ *  @param  investments     ݎ
+ *  @param  now_time        ݎb
+ *  @param  sec_time        ZNVJn
+ *  @param  em_group        ً}[hΏۃO[v<헪O[vID>
+ *  @param  valuedata       if[^(1)
+ *  @param  script_mng      Oݒ(XNvg)Ǘ
+ *  @param  distance        ڋߗ[%]
+ *  @param  near_func       ڋߒʒm֐
+ */
+void StockTradingTactics::InterpretNear(eStockInvestmentsType investments,
+                                        const garnet::HHMMSS& now_time,
+                                        const garnet::HHMMSS& sec_time,
+                                        const std::unordered_set<int32_t>& em_group,
+                                        const StockValueData& valuedata,
+                                        TradeAssistantSetting& script_mng,
+                                        float32 distance,
+                                        const NearOrderFunc& near_func) const
+{
+    const bool b_pts = investments == INVESTMENTS_PTS;
+    const auto notify = [investments, &valuedata, &near_func](eOrderType type,
+                                                              bool b_leverage,
+                                                              int32_t number,
+                                                              eOrderCondition cond)
+    {
+        StockOrder order;
+        order.m_code = valuedata.m_code;
+        order.m_type = type;
+        order.m_b_leverage = b_leverage;
+        order.m_number = number;
+        order.m_condition = cond;
+        order.m_investments = investments;
+        near_func(order);
+    };
+
+    // VK
+    for (const auto& order: m_fresh) {
+        if (em_group.end() != em_group.find(order.GetGroupID())) {
+            continue; // ً}[h
+        }
+        if (b_pts && order.IsLeverage()) {
+            continue; // PTS͐Mps
+        }
+        if (!order.JudgeNear(now_time, sec_time, valuedata, script_mng, distance)) {
+            continue;
+        }
+        notify(order.GetType(), order.IsLeverage(), order.GetNumber(), order.GetOrderCondition());
+    }
+    // ԍϒ(̂/Mpԍς͌ʑIv̂őΏۊO)
+    for (const auto& order: m_repayment) {
+        if (order.IsLeverage()) {
+            continue;
+        }
+        if (em_group.end() != em_group.find(order.GetGroupID())) {
+            continue; // ً}[h
+        }
+        if (!order.JudgeNear(now_time, sec_time, valuedata, script_mng, distance)) {
+            continue;
+        }
+        notify(ORDER_SELL, false, order.GetNumber(), order.GetOrderCondition());
+    }
+}
+
 } // namespace trading
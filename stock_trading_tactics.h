@@ -19,6 +19,7 @@
 namespace trading
 {
 
+struct StockOrder;
 struct StockValueData;
 class TradeAssistantSetting;
 
@@ -105,6 +106,37 @@ public:
                    const garnet::HHMMSS& sec_time,
                    const StockValueData& valuedata,
                    TradeAssistantSetting& script_mng) const;
+        /*!
+         *  @brief  ڋߔ
+         *  @param  now_time    ݎb
+         *  @param  sec_time    ZNVJn
+         *  @param  valuedata   if[^(1)
+         *  @param  script_mng  Oݒ(XNvg)Ǘ
+         *  @param  distance    ڋߗ[%]
+         *  @retval true        gK[܂distance[%]ȓ
+         *  @note   distance̓gK[_̑΋(_̉%O܂ŗĂ邩)
+         *  @note   VALUE_GAP͓ANO_CONTRACT͖bASCRIPT_FUNCTION͉i̐_ɑ΂đ
+         */
+        bool JudgeNear(const garnet::HHMMSS& now_time,
+                       const garnet::HHMMSS& sec_time,
+                       const StockValueData& valuedata,
+                       TradeAssistantSetting& script_mng,
+                       float32 distance) const;
+
+    private:
+        /*!
+         *  @brief  ({)
+         *  @param  now_time    ݎb
+         *  @param  sec_time    ZNVJn
+         *  @param  valuedata   if[^(1)
+         *  @param  script_mng  Oݒ(XNvg)Ǘ
+         *  @param  near_rate   ڋߗ(0Ȃʏ픻)
+         */
+        bool JudgeCore(const garnet::HHMMSS& now_time,
+                       const garnet::HHMMSS& sec_time,
+                       const StockValueData& valuedata,
+                       TradeAssistantSetting& script_mng,
+                       float64 near_rate) const;
     };
 
     /*!
@@ -260,6 +292,29 @@ public:
                    TradeAssistantSetting& script_mng,
                    const EnqueueFunc& enqueue_func) const;
 
+    /*!
+     *  @brief  gK[ڋߒ
+     *  @param  investments     ݎ
+     *  @param  now_time        ݎb
+     *  @param  sec_time        ZNVJn
+     *  @param  em_group        ً}[hΏۃO[v<헪O[vID>
+     *  @param  valuedata       if[^(1)
+     *  @param  script_mng      Oݒ(XNvg)Ǘ
+     *  @param  distance        ڋߗ[%]
+     *  @param  near_func       ڋߒʒm֐
+     *  @note   Ώۂ͔(EMpVK)̂
+     *  @note   ʒm钍̉i͖(0)
+     */
+    typedef std::function<void(const StockOrder&)> NearOrderFunc;
+    void InterpretNear(eStockInvestmentsType investments,
+                       const garnet::HHMMSS& now_time,
+                       const garnet::HHMMSS& sec_time,
+                       const std::unordered_set<int32_t>& em_group,
+                       const StockValueData& valuedata,
+                       TradeAssistantSetting& script_mng,
+                       float32 distance,
+                       const NearOrderFunc& near_func) const;
+
 private:
     int32_t m_unique_id;                //!< ŗLID(헪f[^ԂŔȂ)
     std::vector<Emergency> m_emergency; //!< ً}[hXg
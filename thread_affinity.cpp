@@ -0,0 +1,230 @@
+/*!
+ *  @file   thread_affinity.cpp
+ *  @brief  Xbhzu(CPUŒ/A^CDx)
+ *  @date   2018/01/30
+ */
+#include "thread_affinity.h"
+
+#include "environment.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif/* defined(__linux__) */
+
+namespace trading
+{
+namespace thread_affinity
+{
+
+namespace
+{
+
+/*!
+ *  @brief  CPUԍǂ
+ *  @param[in]  src 
+ *  @param[out] dst i[
+ *  @retval true    (0ȏ̐)
+ */
+bool read_cpu_number(const std::string& src, int32_t& dst)
+{
+    if (src.empty() || src.find_first_not_of("0123456789") != std::string::npos || src.size() > 4) {
+        return false;
+    }
+    dst = static_cast<int32_t>(strtol(src.c_str(), nullptr, 10));
+    return true;
+}
+
+//! vZXNCPUW(Ȃ疢L^)
+std::vector<int32_t> g_process_cpu;
+
+/*!
+ *  @brief  Ő󔒂
+ */
+std::string trim(const std::string& src)
+{
+    const auto begin = src.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return std::string();
+    }
+    const auto end = src.find_last_not_of(" \t");
+    return src.substr(begin, end - begin + 1);
+}
+
+} // namespace
+
+/*!
+ *  @brief  CPUԍXg
+ *  @param[in]  src "0,2-3"`(ȂwȂ)
+ *  @param[out] dst i[(/dȂ)
+ */
+bool ParseCPUList(const std::string& src, std::vector<int32_t>& dst)
+{
+    std::vector<int32_t> cpu;
+    size_t pos = 0;
+    while (pos <= src.size()) {
+        const size_t comma = std::min(src.find(',', pos), src.size());
+        const std::string elem(trim(src.substr(pos, comma - pos)));
+        pos = comma + 1;
+        if (elem.empty()) {
+            continue;
+        }
+        const size_t hyphen = elem.find('-');
+        int32_t first = 0;
+        int32_t last = 0;
+        if (hyphen == std::string::npos) {
+            if (!read_cpu_number(elem, first)) {
+                return false;
+            }
+            last = first;
+        } else if (!read_cpu_number(trim(elem.substr(0, hyphen)), first) ||
+                   !read_cpu_number(trim(elem.substr(hyphen + 1)), last) ||
+                   first > last) {
+            return false;
+        }
+        for (int32_t inx = first; inx <= last; inx++) {
+            cpu.push_back(inx);
+        }
+    }
+    std::sort(cpu.begin(), cpu.end());
+    cpu.erase(std::unique(cpu.begin(), cpu.end()), cpu.end());
+    dst.swap(cpu);
+    return true;
+}
+
+/*!
+ *  @brief  vZXNCPUWL^
+ */
+void CaptureProcessCPU()
+{
+    std::vector<int32_t> cpu;
+#if defined(_WIN32)
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) != 0) {
+        for (int32_t c = 0; c < static_cast<int32_t>(sizeof(DWORD_PTR)*8); c++) {
+            if ((process_mask & (static_cast<DWORD_PTR>(1) << c)) != 0) {
+                cpu.push_back(c);
+            }
+        }
+    }
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int32_t c = 0; c < CPU_SETSIZE; c++) {
+            if (CPU_ISSET(c, &set)) {
+                cpu.push_back(c);
+            }
+        }
+    }
+#endif/* _WIN32 */
+    g_process_cpu.swap(cpu);
+}
+
+/*!
+ *  @brief  ďoXbh̔zuݒ
+ *  @param  cpu             gCPUԍ(ȂςȂ)
+ *  @param  fifo_priority   SCHED_FIFODx(0Ȃʏ̃XPW[Oɖ߂)
+ */
+bool SetCurrentThread(const std::vector<int32_t>& cpu, int32_t fifo_priority)
+{
+    bool b_result = true;
+#if defined(_WIN32)
+    if (!cpu.empty()) {
+        DWORD_PTR mask = 0;
+        for (int32_t c: cpu) {
+            if (c < static_cast<int32_t>(sizeof(DWORD_PTR)*8)) {
+                mask |= static_cast<DWORD_PTR>(1) << c;
+            }
+        }
+        b_result = (mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0);
+    }
+#elif defined(__linux__)
+    const pthread_t self = pthread_self();
+    if (!cpu.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int32_t c: cpu) {
+            if (c < CPU_SETSIZE) {
+                CPU_SET(c, &set);
+            }
+        }
+        b_result = (pthread_setaffinity_np(self, sizeof(set), &set) == 0);
+    }
+    int policy = SCHED_OTHER;
+    sched_param param;
+    if (pthread_getschedparam(self, &policy, &param) != 0) {
+        return false;
+    }
+    if (fifo_priority > 0) {
+        const int32_t prio_min = sched_get_priority_min(SCHED_FIFO);
+        const int32_t prio_max = sched_get_priority_max(SCHED_FIFO);
+        param.sched_priority = std::max(prio_min, std::min(fifo_priority, prio_max));
+        b_result = (pthread_setschedparam(self, SCHED_FIFO, &param) == 0) && b_result;
+    } else if (policy != SCHED_OTHER) {
+        param.sched_priority = 0;
+        b_result = (pthread_setschedparam(self, SCHED_OTHER, &param) == 0) && b_result;
+    }
+#else
+    b_result = cpu.empty();
+#endif/* _WIN32 */
+    return b_result;
+}
+
+/*!
+ *  @brief  ďoXbhɉĔzu
+ *  @param  role    
+ */
+bool ApplyCurrentThread(eThreadRole role)
+{
+    std::shared_ptr<const Environment> env(Environment::GetInstance().lock());
+    if (!env) {
+        return true;
+    }
+    std::string cpu_str;
+    int32_t fifo_priority = 0;
+    switch (role)
+    {
+    case ROLE_TRADING:
+        cpu_str = env->GetTradingThreadCPU();
+        fifo_priority = env->GetTradingThreadFIFOPriority();
+        break;
+    case ROLE_NETWORK:
+        cpu_str = env->GetNetworkThreadCPU();
+        break;
+    case ROLE_WORKER:
+        cpu_str = env->GetWorkerThreadCPU();
+        break;
+    default:
+        return false;
+    }
+    std::vector<int32_t> cpu;
+    if (!ParseCPUList(cpu_str, cpu)) {
+        return false;
+    }
+    if (cpu.empty() && role != ROLE_TRADING) {
+        // wȂ  NCPUWɖ߂(XbȟŒpĂ邱Ƃ)
+        cpu = g_process_cpu;
+    }
+    return SetCurrentThread(cpu, fifo_priority);
+}
+
+/*!
+ *  @brief  ďoXbhɉĔzu(XbhƂɍŏ̈񂾂)
+ *  @param  role    
+ */
+void ApplyCurrentThreadOnce(eThreadRole role)
+{
+    static thread_local bool b_applied = false;
+    if (!b_applied) {
+        b_applied = true;
+        ApplyCurrentThread(role);
+    }
+}
+
+} // namespace thread_affinity
+} // namespace trading
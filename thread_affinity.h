@@ -0,0 +1,71 @@
+/*!
+ *  @file   thread_affinity.h
+ *  @brief  Xbhzu(CPUŒ/A^CDx)
+ *  @date   2018/01/30
+ *  @note   trade_assistant.ini[Thread]ɏ]AƂɃXbhgCPUŒ肷
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace trading
+{
+namespace thread_affinity
+{
+
+/*!
+ *  @brief  Xbh̖
+ */
+enum eThreadRole
+{
+    ROLE_TRADING,   //!< (TradeAssistor::Update񂷃Xbh)
+    ROLE_NETWORK,   //!< ʐM(cpprest̃Xbhv[/ڑv[̃^C})
+    ROLE_WORKER,    //!< /Oo
+};
+
+/*!
+ *  @brief  CPUԍXg
+ *  @param[in]  src "0,2-3"`(ȂwȂ)
+ *  @param[out] dst i[(/dȂ)
+ *  @retval true    
+ */
+bool ParseCPUList(const std::string& src, std::vector<int32_t>& dst);
+
+/*!
+ *  @brief  vZXNCPUWL^
+ *  @note   NAǂ̃XbhzuO(CXbh)xĂ
+ *  @note   linuxł͐XbhXbhCPUŒp̂ŁA
+ *  @note   ȊOŎw肪Ȃ΂CPUWɖ߂(XbhCPUɊ񂹂Ȃ)
+ */
+void CaptureProcessCPU();
+
+/*!
+ *  @brief  ďoXbh̔zuݒ
+ *  @param  cpu             gCPUԍ(ȂςȂ)
+ *  @param  fifo_priority   SCHED_FIFODx(0Ȃʏ̃XPW[Oɖ߂)
+ *  @retval true    
+ *  @note   SCHED_FIFOlinux̂(ł͖)/(CAP_SYS_NICE)ȂΎs
+ */
+bool SetCurrentThread(const std::vector<int32_t>& cpu, int32_t fifo_priority);
+
+/*!
+ *  @brief  ďoXbhɉĔzu
+ *  @param  role    
+ *  @retval true    
+ *  @note   ݒEnvironment瓾
+ *  @note   Xbh͎w肪ȂΌŒ肵Ȃ
+ *  @note   ȊO͎w肪Ȃ΋NCPUW(CaptureProcessCPU)ɖ߂Aʏ̃XPW[Oɖ߂
+ *  @note   (Xbh琶CPUŒSCHED_FIFOp邽)
+ */
+bool ApplyCurrentThread(eThreadRole role);
+/*!
+ *  @brief  ďoXbhɉĔzu(XbhƂɍŏ̈񂾂)
+ *  @param  role    
+ *  @note   OŐȂXbh(cpprest̃Xbhv[)p
+ */
+void ApplyCurrentThreadOnce(eThreadRole role);
+
+} // namespace thread_affinity
+} // namespace trading
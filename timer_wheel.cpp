@@ -0,0 +1,558 @@
+/*!
+ *  @file   timer_wheel.cpp
+ *  @brief  Kw^C}[zC[
+ *  @date   2018/01/28
+ */
+#include "timer_wheel.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <list>
+#include <unordered_map>
+
+namespace trading
+{
+
+class TimerWheel::PIMPL
+{
+private:
+    enum
+    {
+        NUM_LEVEL = 5,              //!< i
+        LV0_BITS = 8,               //!< 1iڂ̘g(bit)
+        LVN_BITS = 6,               //!< 2iڈȍ~̘g(bit)
+        LV0_SLOT = 1 << LV0_BITS,   //!< 1iڂ̘g
+        LVN_SLOT = 1 << LVN_BITS,   //!< 2iڈȍ~̘g
+        WORD_BITS = 64,             //!< ggp1[hbit
+        MAX_WORD = LV0_SLOT/WORD_BITS,
+
+        FIRING_LEVEL = -1,          //!< (iɑȂ)
+    };
+    //! Siŕ\P\[~b] ̃^C}[͍ŏi̒[ɒuAJグɒu
+    static const int64_t MAX_SPAN = 1LL << (LV0_BITS + LVN_BITS*(NUM_LEVEL-1));
+
+    /*!
+     *  @brief  ^C}[
+     */
+    struct Timer
+    {
+        TimerID m_id;           //!< ʎq
+        int64_t m_expire;       //!< (tickCount)
+        int64_t m_interval;     //!< [~b](0Ȃx)
+        Callback m_callback;    //!< 
+
+        Timer(TimerID id, int64_t expire, int64_t interval, const Callback& callback)
+        : m_id(id)
+        , m_expire(expire)
+        , m_interval(interval)
+        , m_callback(callback)
+        {
+        }
+    };
+    typedef std::list<Timer> Slot;
+
+    /*!
+     *  @brief  ^C}[
+     *  @note   std::list::splice̓Ce[^𖳌ɂȂ̂ŘgԂڂĂ̂܂܎g
+     */
+    struct Location
+    {
+        int32_t m_level;        //!< i(FIRING_LEVELȂ疞)
+        int32_t m_slot;         //!< g
+        Slot::iterator m_it;    //!< vf
+
+        Location()
+        : m_level(FIRING_LEVEL)
+        , m_slot(0)
+        , m_it()
+        {
+        }
+        Location(int32_t level, int32_t slot, const Slot::iterator& it)
+        : m_level(level)
+        , m_slot(slot)
+        , m_it(it)
+        {
+        }
+    };
+
+    Slot m_wheel0[LV0_SLOT];                        //!< 1i
+    Slot m_wheelN[NUM_LEVEL-1][LVN_SLOT];           //!< 2iڈȍ~
+    uint64_t m_occupied[NUM_LEVEL][MAX_WORD];       //!< ggp(bit)
+    Slot m_firing;                                  //!< ^C}[
+    std::unordered_map<TimerID, Location> m_index;  //!< <ʎq, >
+    int64_t m_current;                              //!< ݎ(ŌɏtickCount)
+    TimerID m_last_id;                              //!< Ōɔsʎq
+
+    PIMPL(const PIMPL&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  i1g̎ԕ(bit)
+     *  @param  level   i
+     */
+    static int32_t GetShift(int32_t level)
+    {
+        return (level == 0) ?0 :LV0_BITS + LVN_BITS*(level-1);
+    }
+    /*!
+     *  @brief  i̘g
+     *  @param  level   i
+     */
+    static int32_t GetNumSlot(int32_t level)
+    {
+        return (level == 0) ?LV0_SLOT :LVN_SLOT;
+    }
+    /*!
+     *  @brief  ŉʂ̗Ăbitʒu
+     *  @param  word    0ȊO
+     */
+    static int32_t FindFirstBit(uint64_t word)
+    {
+        // de Bruijnɂ
+        static const int32_t TABLE[64] = {
+             0,  1, 56,  2, 57, 49, 28,  3, 61, 58, 42, 50, 38, 29, 17,  4,
+            62, 47, 59, 36, 45, 43, 51, 22, 53, 39, 33, 30, 24, 18, 12,  5,
+            63, 55, 48, 27, 60, 41, 37, 16, 46, 35, 44, 21, 52, 32, 23, 11,
+            54, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6,
+        };
+        const uint64_t DEBRUIJN = 0x03f79d71b4ca8b09ULL;
+        return TABLE[((word & (~word + 1)) * DEBRUIJN) >> 58];
+    }
+    /*!
+     *  @brief  gp̘gT
+     *  @param  level   i
+     *  @param  start   Tn߂g
+     *  @return start琔ĉg悩(gp̘gȂ-1)
+     *  @note   start(start̘gg܂)
+     */
+    int32_t FindNextSlot(int32_t level, int32_t start) const
+    {
+        const int32_t num_slot = GetNumSlot(level);
+        const int32_t num_word = std::max(1, num_slot/static_cast<int32_t>(WORD_BITS));
+        const uint64_t* bits = m_occupied[level];
+        const int32_t start_word = start/WORD_BITS;
+        const int32_t start_bit = start%WORD_BITS;
+        for (int32_t n = 0; n <= num_word; n++) {
+            const int32_t w = (start_word + n)%num_word;
+            uint64_t word = bits[w];
+            if (n == 0) {
+                word &= ~0ULL << start_bit;
+            } else if (n == num_word) {
+                // čŏ̃[hstartO
+                word &= (start_bit == 0) ?0 :((1ULL << start_bit) - 1);
+            }
+            if (word != 0) {
+                const int32_t slot = w*WORD_BITS + FindFirstBit(word);
+                return (slot - start + num_slot)%num_slot;
+            }
+        }
+        return -1;
+    }
+
+    /*!
+     *  @brief  g𓾂
+     *  @param  level   i
+     *  @param  slot    g
+     */
+    Slot& GetSlot(int32_t level, int32_t slot)
+    {
+        return (level == 0) ?m_wheel0[slot] :m_wheelN[level-1][slot];
+    }
+    /*!
+     *  @brief  ggp󋵍XV
+     *  @param  level   i
+     *  @param  slot    g
+     */
+    void UpdateOccupied(int32_t level, int32_t slot)
+    {
+        const uint64_t bit = 1ULL << (slot%WORD_BITS);
+        uint64_t& word = m_occupied[level][slot/WORD_BITS];
+        if (GetSlot(level, slot).empty()) {
+            word &= ~bit;
+        } else {
+            word |= bit;
+        }
+    }
+    /*!
+     *  @brief  ݂̃Xg𓾂
+     *  @param  loc 
+     */
+    Slot& GetList(const Location& loc)
+    {
+        return (loc.m_level == FIRING_LEVEL) ?m_firing :GetSlot(loc.m_level, loc.m_slot);
+    }
+
+    /*!
+     *  @brief  ^C}[𖞗ɉgֈڂ
+     *  @param  src         ړXg
+     *  @param  it          ^C}[
+     *  @param  earliest    ̉(߂Ă^C}[͂̎ɖ)
+     */
+    void Place(Slot& src, const Slot::iterator& it, int64_t earliest)
+    {
+        it->m_expire = std::max(it->m_expire, earliest);
+        const int64_t delta = it->m_expire - m_current;
+        const int64_t expire = (delta < MAX_SPAN) ?it->m_expire :m_current + MAX_SPAN - 1;
+        int32_t level = 0;
+        for (; level < NUM_LEVEL - 1; level++) {
+            if ((expire - m_current) < (1LL << (GetShift(level) +
+                                                ((level == 0) ?LV0_BITS :LVN_BITS)))) {
+                break;
+            }
+        }
+        const int32_t slot
+            = static_cast<int32_t>((expire >> GetShift(level)) & (GetNumSlot(level) - 1));
+        Slot& dst = GetSlot(level, slot);
+        dst.splice(dst.end(), src, it);
+        UpdateOccupied(level, slot);
+        m_index[it->m_id] = Location(level, slot, it);
+    }
+
+    /*!
+     *  @brief  ̒i̘g̒i֌J艺
+     *  @param  level   i
+     *  @param  slot    g
+     */
+    void Cascade(int32_t level, int32_t slot)
+    {
+        Slot tmp;
+        tmp.splice(tmp.end(), GetSlot(level, slot));
+        UpdateOccupied(level, slot);
+        // ̎ɖ̂͌J艺ɖ
+        while (!tmp.empty()) {
+            Place(tmp, tmp.begin(), m_current);
+        }
+    }
+
+    /*!
+     *  @brief  ɏׂ𓾂
+     *  @param  from    ̎ȍ~T
+     *  @return tickCount(1iڂ̎gpgA̒i̎gpgJ艺鎞̑)
+     */
+    int64_t GetNextEventTick(int64_t from) const
+    {
+        int64_t next = INT64_MAX;
+        const int32_t off0 = FindNextSlot(0, static_cast<int32_t>(from & (LV0_SLOT - 1)));
+        if (off0 >= 0) {
+            next = from + off0;
+        }
+        for (int32_t level = 1; level < NUM_LEVEL; level++) {
+            // (tick >> shift)&63 == slot  bit0 ̎ɌJ艺
+            const int32_t shift = GetShift(level);
+            const int64_t unit = 1LL << shift;
+            const int64_t base = (from + unit - 1) >> shift;
+            const int32_t off = FindNextSlot(level, static_cast<int32_t>(base & (LVN_SLOT - 1)));
+            if (off >= 0) {
+                next = std::min(next, (base + off) << shift);
+            }
+        }
+        return next;
+    }
+
+    /*!
+     *  @brief  1̏
+     *  @param  tick    鎞
+     */
+    void ProcessTick(int64_t tick)
+    {
+        m_current = tick;
+        // J艺(1iڂ2iځA2iڂ3iځc)
+        if ((tick & (LV0_SLOT - 1)) == 0) {
+            for (int32_t level = 1; level < NUM_LEVEL; level++) {
+                const int32_t slot
+                    = static_cast<int32_t>((tick >> GetShift(level)) & (LVN_SLOT - 1));
+                Cascade(level, slot);
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+        // 
+        const int32_t slot0 = static_cast<int32_t>(tick & (LV0_SLOT - 1));
+        Slot& expired = GetSlot(0, slot0);
+        if (expired.empty()) {
+            return;
+        }
+        for (auto it = expired.begin(); it != expired.end(); ++it) {
+            m_index[it->m_id] = Location(FIRING_LEVEL, 0, it);
+        }
+        m_firing.splice(m_firing.end(), expired);
+        UpdateOccupied(0, slot0);
+        while (!m_firing.empty()) {
+            const TimerID id = m_firing.front().m_id;
+            // ̒ŎgjĂǂ悤Rs[ĂĂ
+            const Callback callback(m_firing.front().m_callback);
+            if (callback) {
+                callback(tick);
+            }
+            const auto itLoc = m_index.find(id);
+            if (itLoc == m_index.end() || itLoc->second.m_level != FIRING_LEVEL) {
+                continue; // jꂽ or Đݒ肳ꂽ
+            }
+            const Slot::iterator itTimer = itLoc->second.m_it;
+            if (itTimer->m_interval > 0) {
+                itTimer->m_expire = tick + itTimer->m_interval;
+                Place(m_firing, itTimer, m_current + 1);
+            } else {
+                m_firing.erase(itTimer);
+                m_index.erase(itLoc);
+            }
+        }
+    }
+
+    /*!
+     *  @brief  ^C}[
+     *  @param  delay_ms    P\[~b]
+     *  @param  interval_ms [~b]
+     *  @param  callback    
+     */
+    TimerID Create(int64_t delay_ms, int64_t interval_ms, const Callback& callback)
+    {
+        const TimerID id = ++m_last_id;
+        Slot tmp;
+        tmp.emplace_back(id, m_current + delay_ms, interval_ms, callback);
+        Place(tmp, tmp.begin(), m_current + 1);
+        return id;
+    }
+
+public:
+    PIMPL()
+    : m_wheel0()
+    , m_wheelN()
+    , m_occupied()
+    , m_firing()
+    , m_index()
+    , m_current(0)
+    , m_last_id(INVALID_ID)
+    {
+    }
+
+    /*!
+     *  @brief  ^C}[o^(x)
+     *  @param  delay_ms    P\[~b]
+     *  @param  callback    
+     */
+    TimerID SetTimer(int64_t delay_ms, const Callback& callback)
+    {
+        return Create(delay_ms, 0, callback);
+    }
+    /*!
+     *  @brief  ^C}[o^()
+     *  @param  interval_ms [~b]
+     *  @param  callback    
+     */
+    TimerID SetIntervalTimer(int64_t interval_ms, const Callback& callback)
+    {
+        const int64_t interval = std::max(interval_ms, static_cast<int64_t>(1));
+        return Create(interval, interval, callback);
+    }
+    /*!
+     *  @brief  ^C}[Đݒ
+     *  @param  id          ^C}[ʎq
+     *  @param  delay_ms    P\[~b]
+     */
+    bool ResetTimer(TimerID id, int64_t delay_ms)
+    {
+        const auto itLoc = m_index.find(id);
+        if (itLoc == m_index.end()) {
+            return false;
+        }
+        const Location loc(itLoc->second);
+        loc.m_it->m_expire = m_current + delay_ms;
+        Place(GetList(loc), loc.m_it, m_current + 1);
+        if (loc.m_level != FIRING_LEVEL) {
+            UpdateOccupied(loc.m_level, loc.m_slot);
+        }
+        return true;
+    }
+    /*!
+     *  @brief  ^C}[j
+     *  @param  id  ^C}[ʎq
+     */
+    void KillTimer(TimerID id)
+    {
+        const auto itLoc = m_index.find(id);
+        if (itLoc == m_index.end()) {
+            return;
+        }
+        const Location loc(itLoc->second);
+        GetList(loc).erase(loc.m_it);
+        if (loc.m_level != FIRING_LEVEL) {
+            UpdateOccupied(loc.m_level, loc.m_slot);
+        }
+        m_index.erase(itLoc);
+    }
+    /*!
+     *  @brief  ^C}[Sj
+     */
+    void KillAllTimer()
+    {
+        for (auto& slot: m_wheel0) {
+            slot.clear();
+        }
+        for (auto& wheel: m_wheelN) {
+            for (auto& slot: wheel) {
+                slot.clear();
+            }
+        }
+        m_firing.clear();
+        m_index.clear();
+        std::fill(&m_occupied[0][0], &m_occupied[0][0] + NUM_LEVEL*MAX_WORD, 0ULL);
+    }
+    /*!
+     *  @brief  o^
+     *  @param  id  ^C}[ʎq
+     */
+    bool IsActive(TimerID id) const
+    {
+        return m_index.find(id) != m_index.end();
+    }
+
+    /*!
+     *  @brief  i߂Ė^C}[
+     *  @param  tickCount   oߎ[~b]
+     */
+    void Advance(int64_t tickCount)
+    {
+        while (m_current < tickCount) {
+            if (m_index.empty()) {
+                // ^C}[ȂΈCɐi߂
+                m_current = tickCount;
+                break;
+            }
+            // NȂ͔΂
+            const int64_t next = GetNextEventTick(m_current + 1);
+            if (next > tickCount) {
+                m_current = tickCount;
+                break;
+            }
+            ProcessTick(next);
+        }
+    }
+
+    /*!
+     *  @brief  ݎ𓾂
+     */
+    int64_t GetCurrentTick() const
+    {
+        return m_current;
+    }
+    /*!
+     *  @brief  ɖ^C}[̎𓾂
+     */
+    int64_t GetNextExpireTick() const
+    {
+        if (m_index.empty()) {
+            return -1;
+        }
+        int64_t next = INT64_MAX;
+        for (int32_t level = 0; level < NUM_LEVEL; level++) {
+            // iƂɒ߂̎gpgΗǂ(ǐ̘g͂x)
+            // ݈ʒu̘gɂ͈̃^C}[蓾̂ŕʓr
+            const int32_t num_slot = GetNumSlot(level);
+            const int32_t cur_slot
+                = static_cast<int32_t>((m_current >> GetShift(level)) & (num_slot - 1));
+            const int32_t start = (cur_slot + 1)%num_slot;
+            const int32_t off = FindNextSlot(level, start);
+            if (off < 0) {
+                continue;
+            }
+            for (int32_t slot: { (start + off)%num_slot, cur_slot }) {
+                const Slot& list = (level == 0) ?m_wheel0[slot] :m_wheelN[level-1][slot];
+                for (const auto& timer: list) {
+                    next = std::min(next, timer.m_expire);
+                }
+            }
+        }
+        return next;
+    }
+};
+
+/*!
+ */
+TimerWheel::TimerWheel()
+: m_pImpl(new PIMPL())
+{
+}
+/*!
+ */
+TimerWheel::~TimerWheel()
+{
+}
+
+/*!
+ *  @brief  ^C}[o^(x)
+ *  @param  delay_ms    ݎ̗P\[~b]
+ *  @param  callback    
+ */
+TimerWheel::TimerID TimerWheel::SetTimer(int64_t delay_ms, const Callback& callback)
+{
+    return m_pImpl->SetTimer(delay_ms, callback);
+}
+/*!
+ *  @brief  ^C}[o^()
+ *  @param  interval_ms [~b]
+ *  @param  callback    
+ */
+TimerWheel::TimerID TimerWheel::SetIntervalTimer(int64_t interval_ms, const Callback& callback)
+{
+    return m_pImpl->SetIntervalTimer(interval_ms, callback);
+}
+/*!
+ *  @brief  ^C}[Đݒ
+ *  @param  id          ^C}[ʎq
+ *  @param  delay_ms    ݎ̗P\[~b]
+ */
+bool TimerWheel::ResetTimer(TimerID id, int64_t delay_ms)
+{
+    return m_pImpl->ResetTimer(id, delay_ms);
+}
+/*!
+ *  @brief  ^C}[j
+ *  @param  id  ^C}[ʎq
+ */
+void TimerWheel::KillTimer(TimerID id)
+{
+    m_pImpl->KillTimer(id);
+}
+/*!
+ *  @brief  ^C}[Sj
+ */
+void TimerWheel::KillAllTimer()
+{
+    m_pImpl->KillAllTimer();
+}
+/*!
+ *  @brief  o^
+ *  @param  id  ^C}[ʎq
+ */
+bool TimerWheel::IsActive(TimerID id) const
+{
+    return m_pImpl->IsActive(id);
+}
+
+/*!
+ *  @brief  i߂Ė^C}[
+ *  @param  tickCount   oߎ[~b]
+ */
+void TimerWheel::Advance(int64_t tickCount)
+{
+    m_pImpl->Advance(tickCount);
+}
+
+/*!
+ *  @brief  ݎ(ŌAdvancetickCount)𓾂
+ */
+int64_t TimerWheel::GetCurrentTick() const
+{
+    return m_pImpl->GetCurrentTick();
+}
+/*!
+ *  @brief  ɖ^C}[̎𓾂
+ */
+int64_t TimerWheel::GetNextExpireTick() const
+{
+    return m_pImpl->GetNextExpireTick();
+}
+
+} // namespace trading
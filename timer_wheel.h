@@ -0,0 +1,101 @@
+/*!
+ *  @file   timer_wheel.h
+ *  @brief  Kw^C}[zC[
+ *  @date   2018/01/28
+ *  @note   v/ҋ@/ً}[hȂǂ̊𖈃t[̌oߎԔru
+ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace trading
+{
+
+/*!
+ *  @brief  Kw^C}[zC[
+ *  @note   \1~bA1i256g+2iڈȍ~64gx4i(49)
+ *  @note   Advance1̏ʂ͖^C}[(+ǐJグ)ɔႷ
+ *  @note   XbhZ[tł͂Ȃ(Xbĥݎg)
+ */
+class TimerWheel
+{
+public:
+    //! ^C}[ʎq(0͖)
+    typedef int64_t TimerID;
+    //! (͖tickCount)
+    typedef std::function<void(int64_t tickCount)> Callback;
+
+    static const TimerID INVALID_ID = 0;
+
+    TimerWheel();
+    ~TimerWheel();
+
+    /*!
+     *  @brief  ^C}[o^(x)
+     *  @param  delay_ms    ݎ(ŌAdvancetickCount)̗P\[~b]
+     *  @param  callback    
+     *  @return ^C}[ʎq
+     *  @note   P\0ȉȂ玟AdvanceŖ
+     */
+    TimerID SetTimer(int64_t delay_ms, const Callback& callback);
+    /*!
+     *  @brief  ^C}[o^()
+     *  @param  interval_ms [~b]
+     *  @param  callback    
+     *  @return ^C}[ʎq
+     *  @note   玟̎𐔂
+     */
+    TimerID SetIntervalTimer(int64_t interval_ms, const Callback& callback);
+    /*!
+     *  @brief  ^C}[Đݒ
+     *  @param  id          ^C}[ʎq
+     *  @param  delay_ms    ݎ̗P\[~b]
+     *  @retval true        (o^)
+     *  @note   ̒玩gĐݒ肵Ăǂ(x̃^C}[łēx)
+     */
+    bool ResetTimer(TimerID id, int64_t delay_ms);
+    /*!
+     *  @brief  ^C}[j
+     *  @param  id  ^C}[ʎq
+     *  @note   ̒Ăłǂ
+     */
+    void KillTimer(TimerID id);
+    /*!
+     *  @brief  ^C}[Sj
+     */
+    void KillAllTimer();
+    /*!
+     *  @brief  o^
+     *  @param  id  ^C}[ʎq
+     */
+    bool IsActive(TimerID id) const;
+
+    /*!
+     *  @brief  i߂Ė^C}[
+     *  @param  tickCount   oߎ[~b]
+     */
+    void Advance(int64_t tickCount);
+
+    /*!
+     *  @brief  ݎ(ŌAdvancetickCount)𓾂
+     */
+    int64_t GetCurrentTick() const;
+    /*!
+     *  @brief  ɖ^C}[̎𓾂
+     *  @return tickCount(^C}[Ȃ-1)
+     *  @note   [v̎܂Ŗ邽߂Ɏg
+     */
+    int64_t GetNextExpireTick() const;
+
+private:
+    TimerWheel(const TimerWheel&);
+    TimerWheel(TimerWheel&&);
+    TimerWheel& operator= (const TimerWheel&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
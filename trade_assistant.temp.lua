@@ -8,6 +8,19 @@ MaxMonitoringCodeRegister = 50  -- 監視銘柄最大登録数
 -- ユーザ任意設定
 StockMonitoringIntervalSecond = 10 -- 監視銘柄情報更新(取得)間隔[秒]
 StockExecInfoIntervalSecond = 64 -- 当日約定情報更新(取得)間隔[秒]
+StockExecInfoActiveIntervalSecond = 8 -- 発注済み注文がある(または発注失敗直後の)間の当日約定情報更新間隔[秒]
+SecuritiesRequestPerMinute = 0 -- 価格データ/当日約定情報の定期要求を合わせた上限回数[回/分](0なら無制限/省略時も0)
+UseNativeHtmlParser = 0 -- 1ならhtml解析(ポートフォリオ・注文)をC++で行う(0ならpython/省略時も0)
+HtmlParserThreads = 0 -- html解析専用スレッド数(0ならhttp応答スレッドでそのまま解析する/省略時も0)
+HtmlParserQueueCapacity = 16 -- html解析待ち行列上限(溢れたらhttp応答スレッドで解析する)
+PollingInflightLimitSecond = 30 -- 価格データ/当日約定情報の定期要求の応答待ち上限[秒](応答待ちの間は次の定期要求を省く/超えたら応答を諦めて要求し直す)
+HttpRequestTimeoutSecond = 30 -- http要求期限[秒](超えたら要求を取り消して失敗扱いにする)
+HttpHedgePercentile = 0 -- 定期要求(GET)の応答がこの百分位の応答時間を超えたら予備の要求を並走させる(0なら使わない/省略時も0)
+HttpHedgeMinMilliSecond = 1000 -- 予備要求を出すまでの最短待ち時間[ミリ秒]
+HttpRequestPerSecond = 0 -- SBIへのhttp要求全体の上限[回/秒](0なら無制限/注文・取消・訂正は待たせない/省略時も0)
+ConnectionPrewarmSecond = 0 -- 東証/PTSの売買開始この秒数前に証券サイトとの接続(DNS/TCP/TLS)を張っておく(0ならしない/省略時も0)
+TradingCalendarFile = "trading_calendar.txt" -- 休日データファイル(1行1日YYYY/MM/DD/範囲内の日付は休場調査を通信なしで行う/空なら毎日カレンダーAPIに問い合わせる)
+TradingCalendarCrossCheck = 0 -- 1なら休日データで休場調査した日もカレンダーAPIに問い合わせて結果を照合する(食い違いはtwitterで通知/待たない)
 EmergencyCoolSecond = 300 -- 緊急モード継続時間(=冷却期間)[秒]
 StockMonitoringLogDir = "log\\" -- 監視銘柄情報出力ディレクトリ
 
@@ -16,6 +29,10 @@ UsePortfolioNumber_Monitor = 0  -- 監視銘柄を登録するポートフォリ
 PortfolioIndicate_Monitor = 5 -- ポートフォリオ表示形式番号：監視銘柄
 PortfolioIndicate_Owned = 6 -- ポートフォリオ表示形式番号：保有銘柄
 
+-- 発注高速化
+OrderPrefetchDistancePercent = 0 -- トリガー成立点の手前この割合[%]以内まで来た注文は注文入力を先読みする(騰落率/無約定秒数/価格の成立点に対する相対距離/0なら先読みしない/省略時も0)
+OrderPrefetchExpireSecond = 30 -- 先読みした注文入力(regist_id)の有効期間[秒]
+
 -- 日本市場固有休業日((土日祝でなくとも休みになる月日)
 JPXHoliday = {
     "12/31", "01/02", "01/03"
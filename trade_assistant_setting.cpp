@@ -6,6 +6,7 @@
 #include "trade_assistant_setting.h"
 
 #include "environment.h"
+#include "scope_profiler.h"
 #include "stock_trading_tactics.h"
 #include "trade_container.h"
 #include "trade_struct.h"
@@ -47,6 +48,36 @@ private:
     int32_t m_pf_indicate_monitoring;
     //! |[gtHI\`FۗL
     int32_t m_pf_indicate_owned;
+    //! ͐ǂݑΏۂƂgK[ڋߗ[%]
+    float32 m_order_prefetch_distance_percent;
+    //! ͐ǂݗL[b]
+    int32_t m_order_prefetch_expire_second;
+    //! ҋ@̓XVԊu[b]
+    int32_t m_stock_exec_info_active_interval_second;
+    //! v̏[/]
+    int32_t m_securities_request_per_minute;
+    //! html͕
+    int32_t m_use_native_html_parser;
+    //! html͐pXbh
+    int32_t m_html_parser_threads;
+    //! html͑҂s
+    int32_t m_html_parser_queue_capacity;
+    //! v҂[b]
+    int32_t m_polling_inflight_limit_second;
+    //! httpv[b]
+    int32_t m_http_request_timeout_second;
+    //! http\v臒lS
+    int32_t m_http_hedge_percentile;
+    //! http\vŒZ҂[~b]
+    int32_t m_http_hedge_min_ms;
+    //! httpv[/b]
+    int32_t m_http_request_per_second;
+    //! ڑOm[b]
+    int32_t m_connection_prewarm_second;
+    //! xf[^t@C
+    std::string m_trading_calendar_file;
+    //! xf[^ƍtO
+    int32_t m_trading_calendar_cross_check;
 
     /*!
      *  @brief  ʕ񂩂񋓎qɕϊ
@@ -407,6 +438,21 @@ public:
     , m_use_pf_number_monitoring(0)
     , m_pf_indicate_monitoring(0)
     , m_pf_indicate_owned(0)
+    , m_order_prefetch_distance_percent(0.f)
+    , m_order_prefetch_expire_second(30)
+    , m_stock_exec_info_active_interval_second(8)
+    , m_securities_request_per_minute(0)
+    , m_use_native_html_parser(0)
+    , m_html_parser_threads(0)
+    , m_html_parser_queue_capacity(16)
+    , m_polling_inflight_limit_second(30)
+    , m_http_request_timeout_second(30)
+    , m_http_hedge_percentile(0)
+    , m_http_hedge_min_ms(1000)
+    , m_http_request_per_second(0)
+    , m_connection_prewarm_second(0)
+    , m_trading_calendar_file()
+    , m_trading_calendar_cross_check(0)
     {
     }
 
@@ -454,6 +500,66 @@ public:
      *  @brief  |[gtHI\`(ۗLp)擾
      */
     int32_t GetPortfolioIndicateForOwned() const { return m_pf_indicate_owned; }
+    /*!
+     *  @brief  ͐ǂݑΏۂƂgK[ڋߗ[%]擾
+     */
+    float32 GetOrderPrefetchDistancePercent() const { return m_order_prefetch_distance_percent; }
+    /*!
+     *  @brief  ͐ǂݗL[b]擾
+     */
+    int32_t GetOrderPrefetchExpireSecond() const { return m_order_prefetch_expire_second; }
+    /*!
+     *  @brief  ҋ@̓XVԊu[b]擾
+     */
+    int32_t GetStockExecInfoActiveIntervalSecond() const { return m_stock_exec_info_active_interval_second; }
+    /*!
+     *  @brief  v̏[/]擾
+     */
+    int32_t GetSecuritiesRequestPerMinute() const { return m_securities_request_per_minute; }
+    /*!
+     *  @brief  html͕擾
+     */
+    int32_t GetUseNativeHtmlParser() const { return m_use_native_html_parser; }
+    /*!
+     *  @brief  html͐pXbh擾
+     */
+    int32_t GetHtmlParserThreads() const { return m_html_parser_threads; }
+    /*!
+     *  @brief  html͑҂s擾
+     */
+    int32_t GetHtmlParserQueueCapacity() const { return m_html_parser_queue_capacity; }
+    /*!
+     *  @brief  v҂[b]擾
+     */
+    int32_t GetPollingInflightLimitSecond() const { return m_polling_inflight_limit_second; }
+    /*!
+     *  @brief  httpv[b]擾
+     */
+    int32_t GetHttpRequestTimeoutSecond() const { return m_http_request_timeout_second; }
+    /*!
+     *  @brief  http\v臒lSʎ擾
+     */
+    int32_t GetHttpHedgePercentile() const { return m_http_hedge_percentile; }
+    /*!
+     *  @brief  http\vŒZ҂[~b]擾
+     */
+    int32_t GetHttpHedgeMinMilliSecond() const { return m_http_hedge_min_ms; }
+    /*!
+     *  @brief  httpv[/b]擾
+     */
+    int32_t GetHttpRequestPerSecond() const { return m_http_request_per_second; }
+    /*!
+     *  @brief  ڑOm[b]擾
+     */
+    int32_t GetConnectionPrewarmSecond() const { return m_connection_prewarm_second; }
+    /*!
+     *  @brief  xf[^t@C擾
+     */
+    const std::string& GetTradingCalendarFile() const { return m_trading_calendar_file; }
+    /*!
+     *  @brief  xf[^ƍtO擾
+     */
+    int32_t GetTradingCalendarCrossCheck() const { return m_trading_calendar_cross_check; }
 
     /*!
      *  @brief  ݒǂݍ
@@ -528,6 +634,51 @@ public:
             o_message.AddErrorMessage("no PortfolioIndicate_Owned.");
             return false;
         }
+        if (!accessor.GetGlobalParam("OrderPrefetchDistancePercent", m_order_prefetch_distance_percent)) {
+            m_order_prefetch_distance_percent = 0.f; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("OrderPrefetchExpireSecond", m_order_prefetch_expire_second)) {
+            m_order_prefetch_expire_second = 30; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("StockExecInfoActiveIntervalSecond", m_stock_exec_info_active_interval_second)) {
+            m_stock_exec_info_active_interval_second = 8; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("SecuritiesRequestPerMinute", m_securities_request_per_minute)) {
+            m_securities_request_per_minute = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("UseNativeHtmlParser", m_use_native_html_parser)) {
+            m_use_native_html_parser = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HtmlParserThreads", m_html_parser_threads)) {
+            m_html_parser_threads = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HtmlParserQueueCapacity", m_html_parser_queue_capacity)) {
+            m_html_parser_queue_capacity = 16; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("PollingInflightLimitSecond", m_polling_inflight_limit_second)) {
+            m_polling_inflight_limit_second = 30; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HttpRequestTimeoutSecond", m_http_request_timeout_second)) {
+            m_http_request_timeout_second = 30; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HttpHedgePercentile", m_http_hedge_percentile)) {
+            m_http_hedge_percentile = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HttpHedgeMinMilliSecond", m_http_hedge_min_ms)) {
+            m_http_hedge_min_ms = 1000; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("HttpRequestPerSecond", m_http_request_per_second)) {
+            m_http_request_per_second = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("ConnectionPrewarmSecond", m_connection_prewarm_second)) {
+            m_connection_prewarm_second = 0; // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("TradingCalendarFile", m_trading_calendar_file)) {
+            m_trading_calendar_file.clear(); // ȗ͊l
+        }
+        if (!accessor.GetGlobalParam("TradingCalendarCrossCheck", m_trading_calendar_cross_check)) {
+            m_trading_calendar_cross_check = 0; // ȗ͊l
+        }
 
         accessor.ClearStack();
         return true;
@@ -684,10 +835,12 @@ public:
      */
     bool CallScriptBoolFunction(int32_t func_ref, float64 f0, float64 f1, float64 f2, float64 f3)
     {
+        TRADE_PROFILE_SCOPE(PHASE_LUA_CALL);
         return m_lua_accessor.CallLuaBoolFunction(func_ref, f0, f1, f2, f3); 
     }
     float64 CallScriptFloatFunction(int32_t func_ref, float64 f0, float64 f1, float64 f2, float64 f3)
     {
+        TRADE_PROFILE_SCOPE(PHASE_LUA_CALL);
         return m_lua_accessor.CallLuaFloatFunction(func_ref, f0, f1, f2, f3);
     }
 };
@@ -793,6 +946,111 @@ int32_t TradeAssistantSetting::GetPortfolioIndicateForOwned() const
 {
     return m_pImpl->GetPortfolioIndicateForOwned();
 }
+/*!
+ *  @brief  ͐ǂݑΏۂƂgK[ڋߗ[%]擾
+ */
+float32 TradeAssistantSetting::GetOrderPrefetchDistancePercent() const
+{
+    return m_pImpl->GetOrderPrefetchDistancePercent();
+}
+/*!
+ *  @brief  ͐ǂݗL[b]擾
+ */
+int32_t TradeAssistantSetting::GetOrderPrefetchExpireSecond() const
+{
+    return m_pImpl->GetOrderPrefetchExpireSecond();
+}
+/*!
+ *  @brief  ҋ@̓XVԊu[b]擾
+ */
+int32_t TradeAssistantSetting::GetStockExecInfoActiveIntervalSecond() const
+{
+    return m_pImpl->GetStockExecInfoActiveIntervalSecond();
+}
+/*!
+ *  @brief  v̏[/]擾
+ */
+int32_t TradeAssistantSetting::GetSecuritiesRequestPerMinute() const
+{
+    return m_pImpl->GetSecuritiesRequestPerMinute();
+}
+/*!
+ *  @brief  html͕擾
+ */
+int32_t TradeAssistantSetting::GetUseNativeHtmlParser() const
+{
+    return m_pImpl->GetUseNativeHtmlParser();
+}
+/*!
+ *  @brief  html͐pXbh擾
+ */
+int32_t TradeAssistantSetting::GetHtmlParserThreads() const
+{
+    return m_pImpl->GetHtmlParserThreads();
+}
+/*!
+ *  @brief  html͑҂s擾
+ */
+int32_t TradeAssistantSetting::GetHtmlParserQueueCapacity() const
+{
+    return m_pImpl->GetHtmlParserQueueCapacity();
+}
+/*!
+ *  @brief  v҂[b]擾
+ */
+int32_t TradeAssistantSetting::GetPollingInflightLimitSecond() const
+{
+    return m_pImpl->GetPollingInflightLimitSecond();
+}
+/*!
+ *  @brief  httpv[b]擾
+ */
+int32_t TradeAssistantSetting::GetHttpRequestTimeoutSecond() const
+{
+    return m_pImpl->GetHttpRequestTimeoutSecond();
+}
+/*!
+ *  @brief  http\v臒lSʎ擾
+ */
+int32_t TradeAssistantSetting::GetHttpHedgePercentile() const
+{
+    return m_pImpl->GetHttpHedgePercentile();
+}
+/*!
+ *  @brief  http\vŒZ҂[~b]擾
+ */
+int32_t TradeAssistantSetting::GetHttpHedgeMinMilliSecond() const
+{
+    return m_pImpl->GetHttpHedgeMinMilliSecond();
+}
+/*!
+ *  @brief  httpv[/b]擾
+ */
+int32_t TradeAssistantSetting::GetHttpRequestPerSecond() const
+{
+    return m_pImpl->GetHttpRequestPerSecond();
+}
+/*!
+ *  @brief  ڑOm[b]擾
+ */
+int32_t TradeAssistantSetting::GetConnectionPrewarmSecond() const
+{
+    return m_pImpl->GetConnectionPrewarmSecond();
+}
+/*!
+ *  @brief  xf[^t@C擾
+ */
+std::string TradeAssistantSetting::GetTradingCalendarFile() const
+{
+    return m_pImpl->GetTradingCalendarFile();
+}
+/*!
+ *  @brief  xf[^ƍtO擾
+ */
+int32_t TradeAssistantSetting::GetTradingCalendarCrossCheck() const
+{
+    return m_pImpl->GetTradingCalendarCrossCheck();
+}
 
 /*!
  *  @brief  JPX̌ŗLxƓ
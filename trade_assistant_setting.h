@@ -83,6 +83,66 @@ public:
      *  @brief  |[gtHI\`(ۗLp)擾
      */
     int32_t GetPortfolioIndicateForOwned() const;
+    /*!
+     *  @brief  ͐ǂݑΏۂƂgK[ڋߗ[%]擾
+     */
+    float32 GetOrderPrefetchDistancePercent() const;
+    /*!
+     *  @brief  ͐ǂݗL[b]擾
+     */
+    int32_t GetOrderPrefetchExpireSecond() const;
+    /*!
+     *  @brief  ҋ@̓XVԊu[b]擾
+     */
+    int32_t GetStockExecInfoActiveIntervalSecond() const;
+    /*!
+     *  @brief  v̏[/]擾
+     */
+    int32_t GetSecuritiesRequestPerMinute() const;
+    /*!
+     *  @brief  html͕擾
+     */
+    int32_t GetUseNativeHtmlParser() const;
+    /*!
+     *  @brief  html͐pXbh擾
+     */
+    int32_t GetHtmlParserThreads() const;
+    /*!
+     *  @brief  html͑҂s擾
+     */
+    int32_t GetHtmlParserQueueCapacity() const;
+    /*!
+     *  @brief  v҂[b]擾
+     */
+    int32_t GetPollingInflightLimitSecond() const;
+    /*!
+     *  @brief  httpv[b]擾
+     */
+    int32_t GetHttpRequestTimeoutSecond() const;
+    /*!
+     *  @brief  http\v臒lSʎ擾
+     */
+    int32_t GetHttpHedgePercentile() const;
+    /*!
+     *  @brief  http\vŒZ҂[~b]擾
+     */
+    int32_t GetHttpHedgeMinMilliSecond() const;
+    /*!
+     *  @brief  httpv[/b]擾
+     */
+    int32_t GetHttpRequestPerSecond() const;
+    /*!
+     *  @brief  ڑOm[b]擾
+     */
+    int32_t GetConnectionPrewarmSecond() const;
+    /*!
+     *  @brief  xf[^t@C擾
+     */
+    std::string GetTradingCalendarFile() const;
+    /*!
+     *  @brief  xf[^ƍtO擾
+     */
+    int32_t GetTradingCalendarCrossCheck() const;
 
     /*!
      *  @brief  JPX̌ŗLxƓf[^\z
@@ -29,6 +29,7 @@ private:
     eSequence m_sequence;                       //!< V[PX
     TradeAssistantSetting m_setting;            //!< OݒǗ
     std::unique_ptr<TradingMachine> m_pMachine; //!< g[h}V
+    std::function<void()> m_wakeup;             //!< Mʓʒm(g[h}Vɓn)
 
     //!< twitterƂ̃ZbV
     std::shared_ptr<garnet::TwitterSessionForAuthor> m_pTwitterSession;
@@ -54,6 +55,7 @@ private:
         case trading::TYPE_STOCK:
             // Machine쐬
             m_pMachine.reset(new StockTradingMachine(m_setting, m_pTwitterSession));
+            m_pMachine->SetWakeUpHandler(m_wakeup);
             m_sequence = SEQ_COMPSETTING;
             break;
         default:
@@ -66,6 +68,7 @@ public:
     : m_sequence(SEQ_NONE)
     , m_setting()
     , m_pMachine()
+    , m_wakeup()
     , m_pTwitterSession(new garnet::TwitterSessionForAuthor(Environment::GetTwitterConfig()))
     {
     }
@@ -145,6 +148,28 @@ public:
             m_pMachine->Update(tickCount, m_setting, o_message);
         }
     }
+
+    /*!
+     *  @brief  UpdateKvȎ𓾂
+     */
+    int64_t GetNextUpdateTick() const
+    {
+        if (m_pMachine) {
+            return m_pMachine->GetNextUpdateTick();
+        }
+        return -1;
+    }
+    /*!
+     *  @brief  Mʓʒmݒ
+     *  @param  handler ʒm
+     */
+    void SetWakeUpHandler(const std::function<void()>& handler)
+    {
+        m_wakeup = handler;
+        if (m_pMachine) {
+            m_pMachine->SetWakeUpHandler(handler);
+        }
+    }
 };
 
 TradeAssistor::TradeAssistor()
@@ -211,4 +236,22 @@ void TradeAssistor::Update(int64_t tickCount, UpdateMessage& o_message)
     m_pImpl->Update(tickCount, o_message);
 }
 
+/*!
+ *  @brief  UpdateKvȎ𓾂
+ *  @return tickCount(sȂ-1)
+ */
+int64_t TradeAssistor::GetNextUpdateTick() const
+{
+    return m_pImpl->GetNextUpdateTick();
+}
+
+/*!
+ *  @brief  Mʓʒmݒ
+ *  @param  handler ʒm(http֘AXbhĂ΂)
+ */
+void TradeAssistor::SetWakeUpHandler(const std::function<void()>& handler)
+{
+    m_pImpl->SetWakeUpHandler(handler);
+}
+
 } // namespace trading
@@ -6,6 +6,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
 
@@ -59,6 +61,19 @@ public:
      */
     void Update(int64_t tickCount, UpdateMessage& o_message);
 
+    /*!
+     *  @brief  UpdateKvȎ𓾂
+     *  @return tickCount(sȂ-1)
+     *  @note   [v͂̎(Updatȇ)Mʓʒm܂Ŗėǂ
+     */
+    int64_t GetNextUpdateTick() const;
+    /*!
+     *  @brief  Mʓʒmݒ
+     *  @param  handler ʒm(http֘AXbhĂ΂/[vNɂ邱)
+     *  @note   ReadSettingƓ(ŏUpdateO)ݒ肷
+     */
+    void SetWakeUpHandler(const std::function<void()>& handler);
+
 private:
     TradeAssistor(const TradeAssistor&);
     TradeAssistor(TradeAssistor&&);
@@ -0,0 +1,339 @@
+/*!
+ *  @file   trade_datetime.cpp
+ *  @brief  g[h֘Autility֐
+ *  @date   2018/01/30
+ */
+#include "trade_datetime.h"
+
+#include "garnet_time.h"
+#include "yymmdd.h"
+#include "utility/utility_datetime.h"
+
+#include <cstring>
+#include <ctime>
+
+namespace trading
+{
+namespace trade_datetime
+{
+
+namespace
+{
+
+const int64_t SECONDS_OF_DAY = 24*60*60;
+
+/*!
+ *  @brief  N1970/01/01̌oߓ𓾂
+ *  @param  year    N()
+ *  @param  mon     (1n܂)
+ *  @param  mday    
+ *  @note   OSI(3n܂ŉ[NɊ񂹂ČvZ)
+ */
+int64_t days_from_civil(int64_t year, int32_t mon, int32_t mday)
+{
+    year -= (mon <= 2) ?1 :0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yoe = year - era*400;                                 // [0, 399]
+    const int64_t doy = (153*(mon + (mon > 2 ? -3 : 9)) + 2)/5 + mday - 1;  // [0, 365]
+    const int64_t doe = yoe*365 + yoe/4 - yoe/100 + doy;                // [0, 146096]
+    return era*146097 + doe - 719468;
+}
+
+bool is_leap_year(int64_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+/*!
+ *  @brief  ̓𓾂
+ *  @param  year    N(/[Np)
+ *  @param  mon     (1n܂)
+ */
+int32_t days_of_month(int64_t year, int32_t mon)
+{
+    static const int32_t DAYS[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return DAYS[mon - 1] + ((mon == 2 && is_leap_year(year)) ?1 :0);
+}
+
+/*!
+ *  @brief  [JƋ萢E̍[b]𓾂
+ *  @note   ̂ݒׂ
+ */
+int64_t local_offset_second()
+{
+    static const int64_t offset = []() -> int64_t
+    {
+        const time_t now = time(nullptr);
+        std::tm lt;
+        std::tm gt;
+#if defined(_MSC_VER)
+        localtime_s(&lt, &now);
+        gmtime_s(&gt, &now);
+#else
+        localtime_r(&now, &lt);
+        gmtime_r(&now, &gt);
+#endif/* _MSC_VER */
+        const int64_t l = days_from_civil(lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday)*SECONDS_OF_DAY
+                        + lt.tm_hour*3600 + lt.tm_min*60 + lt.tm_sec;
+        const int64_t g = days_from_civil(gt.tm_year + 1900, gt.tm_mon + 1, gt.tm_mday)*SECONDS_OF_DAY
+                        + gt.tm_hour*3600 + gt.tm_min*60 + gt.tm_sec;
+        return l - g;
+    }();
+    return offset;
+}
+
+/*!
+ *  @brief  nǂ
+ *  @param[in]  p   擪
+ *  @param[in]  n   
+ *  @param[out] dst i[
+ *  @retval true    SĐ
+ */
+template<typename CharT>
+bool read_digits(const CharT* p, int32_t n, int32_t& dst)
+{
+    int32_t v = 0;
+    for (int32_t inx = 0; inx < n; inx++) {
+        const CharT c = p[inx];
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        v = v*10 + static_cast<int32_t>(c - '0');
+    }
+    dst = v;
+    return true;
+}
+
+/*!
+ *  @brief  p3ƍ
+ */
+template<typename CharT>
+bool match3(const CharT* p, const char* name)
+{
+    return p[0] == name[0] && p[1] == name[1] && p[2] == name[2];
+}
+
+template<typename CharT>
+bool parse_rfc1123(const CharT* p, size_t len, garnet::sTime& dst)
+{
+    // "Www, DD Mmm YYYY HH:MM:SS GMT"
+    const size_t RFC1123_LEN = 29;
+    if (len != RFC1123_LEN ||
+        p[3] != ',' || p[4] != ' ' || p[7] != ' ' || p[11] != ' ' || p[16] != ' ' ||
+        p[19] != ':' || p[22] != ':' || p[25] != ' ' || !match3(p + 26, "GMT")) {
+        return false;
+    }
+    static const char* MONTH[12] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+    int32_t mon = -1;
+    for (int32_t inx = 0; inx < 12; inx++) {
+        if (match3(p + 8, MONTH[inx])) {
+            mon = inx + 1;
+            break;
+        }
+    }
+    int32_t year, mday, hour, minute, second;
+    if (mon < 0 ||
+        !read_digits(p + 5, 2, mday) || !read_digits(p + 12, 4, year) ||
+        !read_digits(p + 17, 2, hour) || !read_digits(p + 20, 2, minute) ||
+        !read_digits(p + 23, 2, second)) {
+        return false;
+    }
+    if (mday < 1 || mday > 31 || hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+    // 萢E[J(tׂ̂Ōoߕbő)
+    const int64_t sec = days_from_civil(year, mon, mday)*SECONDS_OF_DAY
+                      + hour*3600 + minute*60 + second + local_offset_second();
+    int64_t days = sec / SECONDS_OF_DAY;
+    int64_t sec_of_day = sec % SECONDS_OF_DAY;
+    if (sec_of_day < 0) {
+        sec_of_day += SECONDS_OF_DAY;
+        days -= 1;
+    }
+    ToDateFromEpochDay(days, dst);
+    dst.tm_hour = static_cast<int32_t>(sec_of_day / 3600);
+    dst.tm_min = static_cast<int32_t>((sec_of_day / 60) % 60);
+    dst.tm_sec = static_cast<int32_t>(sec_of_day % 60);
+    dst.tm_isdst = 0;
+    return true;
+}
+
+/*!
+ *  @brief  "HH:MM:SS"ǂ
+ */
+bool parse_hhmmss(const char* p, garnet::sTime& dst)
+{
+    int32_t hour, minute, second;
+    if (p[2] != ':' || p[5] != ':' ||
+        !read_digits(p, 2, hour) || !read_digits(p + 3, 2, minute) || !read_digits(p + 6, 2, second)) {
+        return false;
+    }
+    if (hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+    dst.tm_hour = hour;
+    dst.tm_min = minute;
+    dst.tm_sec = second;
+    return true;
+}
+
+} // namespace
+
+/*!
+ *  @brief  RFC1123`(httpDate)[Jɕϊ
+ *  @param[in]  src "Sun, 28 Jan 2018 03:04:05 GMT"
+ *  @param[out] dst i[([J)
+ */
+bool ParseRFC1123(const std::wstring& src, garnet::sTime& dst)
+{
+    return parse_rfc1123(src.c_str(), src.size(), dst);
+}
+bool ParseRFC1123(const std::string& src, garnet::sTime& dst)
+{
+    return parse_rfc1123(src.c_str(), src.size(), dst);
+}
+/*!
+ *  @brief  RFC1123`(httpDate)[Jɕϊ
+ *  @param[in]  src "Sun, 28 Jan 2018 03:04:05 GMT"
+ *  @param[out] dst i[([J)
+ */
+void ToLocalTimeFromRFC1123(const std::wstring& src, garnet::sTime& dst)
+{
+    if (!parse_rfc1123(src.c_str(), src.size(), dst)) {
+        // zȌȂėp̕ϊ
+        auto pt(std::move(garnet::utility_datetime::ToLocalTimeFromRFC1123(src)));
+        garnet::utility_datetime::ToTimeFromBoostPosixTime(pt, dst);
+    }
+}
+
+/*!
+ *  @brief  ϊ
+ *  @param[in]  src "MM/DD HH:MM:SS" ܂ "MM/DDHH:MM:SS"(tƎ̊Ԃ̋󔒂Ȃ)
+ *  @param[out] dst i[(b̂ݏ)
+ */
+bool ParseExecDateTime(const std::string& src, garnet::sTime& dst)
+{
+    const size_t MMDD_LEN = 5;
+    const size_t HHMMSS_LEN = 8;
+    const char* p = src.c_str();
+    size_t time_pos = MMDD_LEN;
+    if (src.size() == MMDD_LEN + 1 + HHMMSS_LEN && p[MMDD_LEN] == ' ') {
+        time_pos = MMDD_LEN + 1;
+    } else if (src.size() != MMDD_LEN + HHMMSS_LEN) {
+        return false;
+    }
+    int32_t mon, mday;
+    if (p[2] != '/' || !read_digits(p, 2, mon) || !read_digits(p + 3, 2, mday)) {
+        return false;
+    }
+    // NȂ̂ŉ[͏ɋ
+    if (mon < 1 || mon > 12 || mday < 1 || mday > days_of_month(2000, mon)) {
+        return false;
+    }
+    garnet::sTime work(dst);
+    if (!parse_hhmmss(p + time_pos, work)) {
+        return false;
+    }
+    dst = work;
+    dst.tm_mon = mon - 1;
+    dst.tm_mday = mday;
+    return true;
+}
+
+/*!
+ *  @brief  ϊ
+ *  @param[in]  src "MM/DD HH:MM:SS" ܂ "MM/DDHH:MM:SS"
+ *  @param[out] dst i[
+ */
+bool ToTimeFromExecDateTime(const std::string& src, garnet::sTime& dst)
+{
+    if (ParseExecDateTime(src, dst)) {
+        return true;
+    }
+    // zȌȂėp̕ϊ(tƎ̊Ԃɋ󔒂)
+    const size_t MMDD_LEN = 5;
+    if (src.size() > MMDD_LEN && src[2] == '/' && src[MMDD_LEN] != ' ') {
+        const std::string datetime(src.substr(0, MMDD_LEN) + " " + src.substr(MMDD_LEN));
+        return garnet::utility_datetime::ToTimeFromString(datetime, "%m/%d %H:%M:%S", dst);
+    }
+    return garnet::utility_datetime::ToTimeFromString(src, "%m/%d %H:%M:%S", dst);
+}
+
+/*!
+ *  @brief  Nϊ
+ *  @param[in]  src "YYYY/MM/DD"
+ *  @param[out] dst i[(N̂ݏ)
+ */
+bool ParseYYYYMMDD(const std::string& src, garnet::sTime& dst)
+{
+    const size_t YYYYMMDD_LEN = 10;
+    const char* p = src.c_str();
+    if (src.size() != YYYYMMDD_LEN || p[4] != '/' || p[7] != '/') {
+        return false;
+    }
+    int32_t year, mon, mday;
+    if (!read_digits(p, 4, year) || !read_digits(p + 5, 2, mon) || !read_digits(p + 8, 2, mday)) {
+        return false;
+    }
+    if (year < 1900 || mon < 1 || mon > 12 || mday < 1 || mday > days_of_month(year, mon)) {
+        return false;
+    }
+    dst.tm_year = year - 1900;
+    dst.tm_mon = mon - 1;
+    dst.tm_mday = mday;
+    return true;
+}
+
+/*!
+ *  @brief  N()YYMMDDɕϊ
+ *  @param  src "YYYY/MM/DD"
+ */
+garnet::YYMMDD ToYYMMDDFromString(const std::string& src)
+{
+    garnet::sTime date_tm;
+    memset(reinterpret_cast<void*>(&date_tm), 0, sizeof(date_tm));
+    if (ParseYYYYMMDD(src, date_tm)) {
+        return garnet::YYMMDD(date_tm);
+    }
+    return garnet::YYMMDD::Create(src);
+}
+
+/*!
+ *  @brief  1970/01/01 00:00:00̌oߕbɕϊ
+ *  @param  src (Nb̂ݎQ)
+ */
+int64_t ToEpochSecond(const garnet::sTime& src)
+{
+    return days_from_civil(src.tm_year + 1900, src.tm_mon + 1, src.tm_mday)*SECONDS_OF_DAY
+         + src.tm_hour*3600 + src.tm_min*60 + src.tm_sec;
+}
+
+/*!
+ *  @brief  1970/01/01̌oߓN(+j/NʎZ)ɕϊ
+ *  @param[in]  days    oߓ
+ *  @param[out] dst     i[(b͐GȂ)
+ */
+void ToDateFromEpochDay(int64_t days, garnet::sTime& dst)
+{
+    const int64_t z = days + 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int64_t doe = z - era*146097;                                 // [0, 146096]
+    const int64_t yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365; // [0, 399]
+    const int64_t doy = doe - (365*yoe + yoe/4 - yoe/100);              // [0, 365]
+    const int64_t mp = (5*doy + 2)/153;                                 // [0, 11]
+    const int32_t mday = static_cast<int32_t>(doy - (153*mp + 2)/5 + 1);
+    const int32_t mon = static_cast<int32_t>(mp < 10 ? mp + 3 : mp - 9);
+    const int64_t year = yoe + era*400 + (mon <= 2 ? 1 : 0);
+    static const int32_t YDAY_OFFSET[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+    dst.tm_year = static_cast<int32_t>(year - 1900);
+    dst.tm_mon = mon - 1;
+    dst.tm_mday = mday;
+    dst.tm_wday = static_cast<int32_t>(((days % 7) + 11) % 7); // 1970/01/01͖ؗj
+    dst.tm_yday = YDAY_OFFSET[mon - 1] + mday - 1 + ((mon > 2 && is_leap_year(year)) ?1 :0);
+}
+
+} // namespace trade_datetime
+} // namespace trading
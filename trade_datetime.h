@@ -0,0 +1,86 @@
+/*!
+ *  @file   trade_datetime.h
+ *  @brief  g[h֘Autility֐
+ *  @date   2018/01/30
+ *  @note   ،Љ̌܂yʔ(boost posix_time/strptimeʂȂ)
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace garnet
+{
+struct sTime;
+struct YYMMDD;
+} // namespace garnet
+
+namespace trading
+{
+namespace trade_datetime
+{
+
+/*!
+ *  @brief  RFC1123`(httpDate)[Jɕϊ
+ *  @param[in]  src "Sun, 28 Jan 2018 03:04:05 GMT"
+ *  @param[out] dst i[([J)
+ *  @retval true    
+ *  @note   łႦΎs(ďoŏ]̕ϊɉ񂷂)
+ *  @note   ͏ďoɈxׂ(ĎԂ̂ȂnO)
+ */
+bool ParseRFC1123(const std::wstring& src, garnet::sTime& dst);
+bool ParseRFC1123(const std::string& src, garnet::sTime& dst);
+/*!
+ *  @brief  RFC1123`(httpDate)[Jɕϊ
+ *  @param[in]  src "Sun, 28 Jan 2018 03:04:05 GMT"
+ *  @param[out] dst i[([J)
+ *  @note   ParseRFC1123œǂ߂ȂΔėp̕ϊ(boost posix_time)
+ */
+void ToLocalTimeFromRFC1123(const std::wstring& src, garnet::sTime& dst);
+
+/*!
+ *  @brief  ϊ
+ *  @param[in]  src "MM/DD HH:MM:SS" ܂ "MM/DDHH:MM:SS"(tƎ̊Ԃ̋󔒂Ȃ)
+ *  @param[out] dst i[(b̂ݏ)
+ *  @retval true    
+ *  @note   N͓ĂȂ̂Ōďoŕ₤
+ */
+bool ParseExecDateTime(const std::string& src, garnet::sTime& dst);
+/*!
+ *  @brief  ϊ
+ *  @param[in]  src "MM/DD HH:MM:SS" ܂ "MM/DDHH:MM:SS"
+ *  @param[out] dst i[
+ *  @retval true    
+ *  @note   ParseExecDateTimeœǂ߂ȂΔėp̕ϊ(strptime)
+ */
+bool ToTimeFromExecDateTime(const std::string& src, garnet::sTime& dst);
+
+/*!
+ *  @brief  Nϊ
+ *  @param[in]  src "YYYY/MM/DD"
+ *  @param[out] dst i[(N̂ݏ)
+ *  @retval true    
+ */
+bool ParseYYYYMMDD(const std::string& src, garnet::sTime& dst);
+/*!
+ *  @brief  N()YYMMDDɕϊ
+ *  @param  src "YYYY/MM/DD"
+ *  @note   ParseYYYYMMDDœǂ߂ȂYYMMDD::Create
+ */
+garnet::YYMMDD ToYYMMDDFromString(const std::string& src);
+
+/*!
+ *  @brief  1970/01/01 00:00:00̌oߕbɕϊ
+ *  @param  src (Nb̂ݎQ)
+ *  @note   ͍lȂ([JȂ烍[J̌oߕbɂȂ)
+ */
+int64_t ToEpochSecond(const garnet::sTime& src);
+/*!
+ *  @brief  1970/01/01̌oߓN(+j/NʎZ)ɕϊ
+ *  @param[in]  days    oߓ
+ *  @param[out] dst     i[(b͐GȂ)
+ */
+void ToDateFromEpochDay(int64_t days, garnet::sTime& dst);
+
+} // namespace trade_datetime
+} // namespace trading
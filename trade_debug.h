@@ -9,6 +9,12 @@
 #define DEBUG_SV_TIME_OVERRIDE  (0)
 //! yj𖳌(ɕ)
 #define DEBUG_DISABLE_HOLIDAY   (0)
+//! html̓x`}[N(L^ςhtmlpythonłnativełr)
+#define DEBUG_BENCHMARK_HTML_PARSER (0)
+//! Ԍv(ScopeProfiler)𖄂ߍ
+#define DEBUG_SCOPE_PROFILER (0)
+//! mیv(O[onew/deleteu)
+#define DEBUG_ALLOCATION_TRACKER (0)
 
 namespace trading
 {
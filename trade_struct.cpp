@@ -198,6 +198,7 @@ StockExecInfoAtOrderHeader::StockExecInfoAtOrderHeader()
 , m_code(StockCode().GetCode())
 , m_b_leverage(false)
 , m_b_complete(false)
+, m_fingerprint(0)
 {
 }
 
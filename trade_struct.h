@@ -284,6 +284,7 @@ struct StockExecInfoAtOrderHeader
     uint32_t m_code;                    //!< R[h
     bool m_b_leverage;                  //!< MptO
     bool m_b_complete;                  //!< 芮tO
+    uint64_t m_fingerprint;             //!< 1̍se̎w(0Ȃs/nativehtml͂ł̂ݐݒ)
 
     StockExecInfoAtOrderHeader();
 };
@@ -5,6 +5,8 @@
  */
 #include "trade_utility.h"
 
+#include <cstring>
+
 namespace trading
 {
 namespace trade_utility
@@ -41,5 +43,86 @@ int32_t BlankOrderID() { return -1; }
  */
 int32_t ValueOrder() { return 1; }
 
+namespace
+{
+
+const uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+const uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+uint64_t xxh_rotl(uint64_t x, int32_t r) { return (x << r) | (x >> (64 - r)); }
+uint64_t xxh_read64(const uint8_t* p) { uint64_t v; memcpy(&v, p, sizeof(v)); return v; } // little endianO
+uint32_t xxh_read32(const uint8_t* p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+uint64_t xxh_round(uint64_t acc, uint64_t input)
+{
+    acc += input * XXH_PRIME64_2;
+    acc = xxh_rotl(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+uint64_t xxh_merge_round(uint64_t acc, uint64_t val)
+{
+    acc ^= xxh_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+} // namespace
+
+/*!
+ *  @brief  oCg̃nbVl(64bit)𓾂
+ *  @param  data    擪
+ *  @param  len     oCg
+ */
+uint64_t hash_bytes(const void* data, size_t len)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = p + len;
+    uint64_t h64 = 0;
+    if (len >= 32) {
+        // 32bytePʂ4[sɏݍ
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = XXH_PRIME64_2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - XXH_PRIME64_1;
+        do {
+            v1 = xxh_round(v1, xxh_read64(p));      p += 8;
+            v2 = xxh_round(v2, xxh_read64(p));      p += 8;
+            v3 = xxh_round(v3, xxh_read64(p));      p += 8;
+            v4 = xxh_round(v4, xxh_read64(p));      p += 8;
+        } while (p <= limit);
+        h64 = xxh_rotl(v1, 1) + xxh_rotl(v2, 7) + xxh_rotl(v3, 12) + xxh_rotl(v4, 18);
+        h64 = xxh_merge_round(h64, v1);
+        h64 = xxh_merge_round(h64, v2);
+        h64 = xxh_merge_round(h64, v3);
+        h64 = xxh_merge_round(h64, v4);
+    } else {
+        h64 = XXH_PRIME64_5;
+    }
+    h64 += static_cast<uint64_t>(len);
+    // [
+    for (; p + 8 <= end; p += 8) {
+        h64 ^= xxh_round(0, xxh_read64(p));
+        h64 = xxh_rotl(h64, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(xxh_read32(p)) * XXH_PRIME64_1;
+        h64 = xxh_rotl(h64, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h64 ^= static_cast<uint64_t>(*p) * XXH_PRIME64_5;
+        h64 = xxh_rotl(h64, 11) * XXH_PRIME64_1;
+    }
+    h64 ^= h64 >> 33;
+    h64 *= XXH_PRIME64_2;
+    h64 ^= h64 >> 29;
+    h64 *= XXH_PRIME64_3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
 } // namespace trade_utility
 } // namespace trading
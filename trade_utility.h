@@ -35,6 +35,15 @@ int32_t BlankOrderID();
  */
 int32_t ValueOrder();
 
+/*!
+ *  @brief  oCg̃nbVl(64bit)𓾂
+ *  @param  data    擪
+ *  @param  len     oCg
+ *  @note   xxHash(XXH64/seed=0)ƓlԂ
+ *  @note   {̂OƓ肷pr(Ípł͂Ȃ)
+ */
+uint64_t hash_bytes(const void* data, size_t len);
+
 
 } // namespace trade_utility
 } // namespace trading
@@ -0,0 +1,363 @@
+/*!
+ *  @file   trading_calendar.cpp
+ *  @brief  J_[(xƓ)
+ *  @date   2018/01/29
+ */
+#include "trading_calendar.h"
+
+#include "update_message.h"
+
+#include "garnet_time.h"
+#include "yymmdd.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace trading
+{
+
+class TradingCalendar::PIMPL
+{
+private:
+    enum
+    {
+        BASE_YEAR = 1900,       //!< tm_year̊N
+        SLOT_PER_YEAR = 366,    //!< 1N̘g([Nɍ킹2/29̘gɎ)
+        SLOT_PER_MONTH = 32,    //!< ŗLxƓ\1̘g
+        MAX_YEAR_RANGE = 100,   //!< N
+    };
+
+    int32_t m_first_year;                   //!< ͈͍ŏ̔N()
+    int32_t m_num_year;                     //!< ͈͔N(0Ȃ͈͂Ȃ)
+    std::vector<uint64_t> m_closed;         //!< xƓbit\
+    std::vector<uint64_t> m_holiday;        //!< xf[^t@Cfړbit\
+    std::vector<uint16_t> m_next_open;      //!< ̉cƓ܂ł̓
+    std::bitset<12*SLOT_PER_MONTH> m_jpx;   //!< ŗLxƓ\(*32+)
+
+    PIMPL(const PIMPL&);
+    PIMPL(PIMPL&&);
+    PIMPL& operator= (const PIMPL&);
+
+    static bool IsLeapYear(int32_t year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+    /*!
+     *  @brief  ̓𓾂
+     *  @param  year    N()
+     *  @param  mon     (0n܂)
+     */
+    static int32_t GetDaysOfMonth(int32_t year, int32_t mon)
+    {
+        static const int32_t DAYS[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return (mon == 1 && IsLeapYear(year)) ?29 :DAYS[mon];
+    }
+    /*!
+     *  @brief  j𓾂
+     *  @param  year    N()
+     *  @param  mon     (0n܂)
+     *  @param  mday    
+     *  @return j(0:j`6:yj)
+     */
+    static int32_t GetWeekDay(int32_t year, int32_t mon, int32_t mday)
+    {
+        static const int32_t OFFSET[12] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+        if (mon < 2) {
+            year -= 1;
+        }
+        return (year + year/4 - year/100 + year/400 + OFFSET[mon] + mday) % 7;
+    }
+
+    /*!
+     *  @brief  bit\̔ԍ𓾂
+     *  @param  year    N()
+     *  @param  mon     (0n܂)
+     *  @param  mday    
+     *  @return ԍ(͈͊OȂ畉)
+     */
+    int32_t ToIndex(int32_t year, int32_t mon, int32_t mday) const
+    {
+        static const int32_t SLOT_OFFSET[12] = { 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335 };
+        const int32_t year_inx = year - m_first_year;
+        if (year_inx < 0 || year_inx >= m_num_year ||
+            mon < 0 || mon >= 12 || mday < 1 || mday > GetDaysOfMonth(year, mon)) {
+            return -1;
+        }
+        return year_inx*SLOT_PER_YEAR + SLOT_OFFSET[mon] + mday - 1;
+    }
+    int32_t ToIndex(const garnet::sTime& date) const
+    {
+        return ToIndex(date.tm_year + BASE_YEAR, date.tm_mon, date.tm_mday);
+    }
+
+    static bool TestBit(const std::vector<uint64_t>& bits, int32_t inx)
+    {
+        return (bits[inx >> 6] & (1ULL << (inx & 63))) != 0;
+    }
+    static void SetBit(std::vector<uint64_t>& bits, int32_t inx)
+    {
+        bits[inx >> 6] |= (1ULL << (inx & 63));
+    }
+
+    /*!
+     *  @brief  xf[^t@C1s
+     *  @param[in]  line    s
+     *  @param[out] o_year  N()
+     *  @param[out] o_mon   (0n܂)
+     *  @param[out] o_mday  
+     *  @retval true    t
+     *  @note   s/ߍsȂo_year=0Ő
+     */
+    static bool ParseLine(const std::string& line, int32_t& o_year, int32_t& o_mon, int32_t& o_mday)
+    {
+        o_year = 0;
+        const std::string body(line.substr(0, line.find('#')));
+        if (body.find_first_not_of(" \t\r") == std::string::npos) {
+            return true;
+        }
+        const char* p = body.c_str();
+        char* end = nullptr;
+        const int32_t year = static_cast<int32_t>(strtol(p, &end, 10));
+        if (*end != '/') {
+            return false;
+        }
+        const int32_t mon = static_cast<int32_t>(strtol(end + 1, &end, 10)) - 1;
+        if (*end != '/') {
+            return false;
+        }
+        const int32_t mday = static_cast<int32_t>(strtol(end + 1, &end, 10));
+        if (body.find_first_not_of(" \t\r", end - p) != std::string::npos) {
+            return false;
+        }
+        if (year <= BASE_YEAR || mon < 0 || mon >= 12 || mday < 1 || mday > GetDaysOfMonth(year, mon)) {
+            return false;
+        }
+        o_year = year;
+        o_mon = mon;
+        o_mday = mday;
+        return true;
+    }
+
+public:
+    PIMPL()
+    : m_first_year(0)
+    , m_num_year(0)
+    , m_closed()
+    , m_holiday()
+    , m_next_open()
+    , m_jpx()
+    {
+    }
+
+    /*!
+     *  @brief  \z
+     *  @param[in]  filename    xf[^t@C
+     *  @param[in]  jpx_holiday ŗLxƓ
+     *  @param[out] o_message   bZ[W(i[)
+     */
+    bool Build(const std::string& filename,
+               const std::vector<garnet::MMDD>& jpx_holiday,
+               UpdateMessage& o_message)
+    {
+        o_message.AddMessage("[TradingCalendar]");
+
+        // ŗLxƓ(2000NŌ/2/29܂߂邽)
+        m_jpx.reset();
+        for (int32_t mon = 0; mon < 12; mon++) {
+            for (int32_t mday = 1; mday <= GetDaysOfMonth(2000, mon); mday++) {
+                garnet::sTime date;
+                memset(reinterpret_cast<void*>(&date), 0, sizeof(date));
+                date.tm_year = 2000 - BASE_YEAR;
+                date.tm_mon = mon;
+                date.tm_mday = mday;
+                const garnet::MMDD mmdd(date);
+                if (std::find(jpx_holiday.begin(), jpx_holiday.end(), mmdd) != jpx_holiday.end()) {
+                    m_jpx.set(mon*SLOT_PER_MONTH + mday);
+                }
+            }
+        }
+        m_first_year = 0;
+        m_num_year = 0;
+        if (filename.empty()) {
+            return true; // t@CwȂ(ŗLxƓ̂)
+        }
+
+        // xf[^t@Cǂݍ
+        std::ifstream ifs(filename);
+        if (!ifs) {
+            o_message.AddErrorMessage("cannot open " + filename + ".");
+            return false;
+        }
+        struct Date { int32_t m_year, m_mon, m_mday; };
+        std::vector<Date> holidays;
+        std::string line;
+        int32_t line_no = 0;
+        while (std::getline(ifs, line)) {
+            line_no++;
+            Date date;
+            if (!ParseLine(line, date.m_year, date.m_mon, date.m_mday)) {
+                o_message.AddErrorMessage("illegal date(line" + std::to_string(line_no) + ").");
+                return false;
+            }
+            if (date.m_year != 0) {
+                holidays.push_back(date);
+            }
+        }
+        if (holidays.empty()) {
+            o_message.AddErrorMessage("no holiday.");
+            return false;
+        }
+        int32_t first_year = holidays.front().m_year;
+        int32_t last_year = first_year;
+        for (const auto& date: holidays) {
+            first_year = std::min(first_year, date.m_year);
+            last_year = std::max(last_year, date.m_year);
+        }
+        if (last_year - first_year + 1 > MAX_YEAR_RANGE) {
+            o_message.AddErrorMessage("too wide year range.");
+            return false;
+        }
+
+        // bit\WJ
+        m_first_year = first_year;
+        m_num_year = last_year - first_year + 1;
+        const size_t num_slot = static_cast<size_t>(m_num_year*SLOT_PER_YEAR);
+        m_closed.assign((num_slot + 63)/64, 0);
+        m_holiday.assign((num_slot + 63)/64, 0);
+        m_next_open.assign(num_slot, 0);
+        for (const auto& date: holidays) {
+            SetBit(m_holiday, ToIndex(date.m_year, date.m_mon, date.m_mday));
+        }
+        std::vector<int32_t> days; // ݂̔ԍ()
+        days.reserve(num_slot);
+        for (int32_t year = first_year; year <= last_year; year++) {
+            for (int32_t mon = 0; mon < 12; mon++) {
+                for (int32_t mday = 1; mday <= GetDaysOfMonth(year, mon); mday++) {
+                    const int32_t inx = ToIndex(year, mon, mday);
+                    const int32_t wday = GetWeekDay(year, mon, mday);
+                    if (wday == 0 || wday == 6 ||
+                        TestBit(m_holiday, inx) || m_jpx.test(mon*SLOT_PER_MONTH + mday)) {
+                        SetBit(m_closed, inx);
+                    }
+                    days.push_back(inx);
+                }
+            }
+        }
+        // ̉cƓ܂ł̓(͈͊O̍ŏ͉̓cƓ)
+        int32_t next_days = 0;
+        for (auto it = days.rbegin(); it != days.rend(); ++it) {
+            next_days = TestBit(m_closed, *it) ?(next_days + 1) :0;
+            m_next_open[*it] = static_cast<uint16_t>(next_days);
+        }
+        return true;
+    }
+
+    bool IsCovered(const garnet::sTime& date) const
+    {
+        return ToIndex(date) >= 0;
+    }
+    bool IsBusinessDay(const garnet::sTime& date) const
+    {
+        const int32_t inx = ToIndex(date);
+        if (inx < 0) {
+            // ͈͊O͓yƌŗLxƓŔ
+            const int32_t wday = GetWeekDay(date.tm_year + BASE_YEAR, date.tm_mon, date.tm_mday);
+            return wday != 0 && wday != 6 && !IsJPXHoliday(date);
+        }
+        return !TestBit(m_closed, inx);
+    }
+    bool IsHoliday(const garnet::sTime& date) const
+    {
+        const int32_t inx = ToIndex(date);
+        return inx >= 0 && TestBit(m_holiday, inx);
+    }
+    bool IsJPXHoliday(const garnet::sTime& date) const
+    {
+        if (date.tm_mon < 0 || date.tm_mon >= 12 || date.tm_mday < 1 || date.tm_mday >= SLOT_PER_MONTH) {
+            return false;
+        }
+        return m_jpx.test(date.tm_mon*SLOT_PER_MONTH + date.tm_mday);
+    }
+    int32_t GetDaysToNextOpen(const garnet::sTime& date) const
+    {
+        const int32_t inx = ToIndex(date);
+        if (inx < 0) {
+            return 0;
+        }
+        return m_next_open[inx];
+    }
+};
+
+TradingCalendar::TradingCalendar()
+: m_pImpl(new PIMPL())
+{
+}
+
+TradingCalendar::~TradingCalendar()
+{
+}
+
+/*!
+ *  @brief  \z
+ *  @param[in]  filename    xf[^t@C
+ *  @param[in]  jpx_holiday ŗLxƓ(yjłȂƂx݂ɂȂ錎)
+ *  @param[out] o_message   bZ[W(i[)
+ *  @retval true    
+ */
+bool TradingCalendar::Build(const std::string& filename,
+                            const std::vector<garnet::MMDD>& jpx_holiday,
+                            UpdateMessage& o_message)
+{
+    return m_pImpl->Build(filename, jpx_holiday, o_message);
+}
+
+/*!
+ *  @brief  ͈͓̓t
+ *  @param  date    t
+ */
+bool TradingCalendar::IsCovered(const garnet::sTime& date) const
+{
+    return m_pImpl->IsCovered(date);
+}
+
+/*!
+ *  @brief  cƓ
+ *  @param  date    t(͈͓ł邱)
+ */
+bool TradingCalendar::IsBusinessDay(const garnet::sTime& date) const
+{
+    return m_pImpl->IsBusinessDay(date);
+}
+
+/*!
+ *  @brief  xf[^t@CɍڂĂ
+ *  @param  date    t(͈͓ł邱)
+ */
+bool TradingCalendar::IsHoliday(const garnet::sTime& date) const
+{
+    return m_pImpl->IsHoliday(date);
+}
+
+/*!
+ *  @brief  ŗLxƓ
+ *  @param  date    t(͈͊Ołǂ)
+ */
+bool TradingCalendar::IsJPXHoliday(const garnet::sTime& date) const
+{
+    return m_pImpl->IsJPXHoliday(date);
+}
+
+/*!
+ *  @brief  ̉cƓ܂ł̓𓾂
+ *  @param  date    t(͈͓ł邱)
+ *  @return (cƓȂ0)
+ */
+int32_t TradingCalendar::GetDaysToNextOpen(const garnet::sTime& date) const
+{
+    return m_pImpl->GetDaysToNextOpen(date);
+}
+
+} // namespace trading
@@ -0,0 +1,83 @@
+/*!
+ *  @file   trading_calendar.h
+ *  @brief  J_[(xƓ)
+ *  @date   2018/01/29
+ *  @note   N̋xf[^t@CNɈxǂݍ݁APʂbit\ɓWJĂ
+ *  @note   ͈͓̓tȂ̋x꒲ɒʐMvȂ
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace garnet { struct sTime; struct MMDD; }
+class UpdateMessage;
+
+namespace trading
+{
+
+/*!
+ *  @brief  J_[
+ *  @note   xƓ = y + xf[^t@CɍڂĂ + ŗLxƓ(N)
+ *  @note   xf[^t@C1s1"YYYY/MM/DD"('#'ȍ~͒)
+ *  @note   ͈͂̓t@CɌꂽŏ̔N11`Ō̔N1231
+ *  @note   tstd::tm(tm_year1900N̔N/tm_mon0n܂)
+ */
+class TradingCalendar
+{
+public:
+    TradingCalendar();
+    ~TradingCalendar();
+
+    /*!
+     *  @brief  \z
+     *  @param[in]  filename    xf[^t@C
+     *  @param[in]  jpx_holiday ŗLxƓ(yjłȂƂx݂ɂȂ錎)
+     *  @param[out] o_message   bZ[W(i[)
+     *  @retval true    
+     *  @note   ŗLxƓ͔͈͊O̓tłɎg
+     */
+    bool Build(const std::string& filename,
+               const std::vector<garnet::MMDD>& jpx_holiday,
+               UpdateMessage& o_message);
+
+    /*!
+     *  @brief  ͈͓̓t
+     *  @param  date    t
+     */
+    bool IsCovered(const garnet::sTime& date) const;
+    /*!
+     *  @brief  cƓ
+     *  @param  date    t(͈͓ł邱)
+     */
+    bool IsBusinessDay(const garnet::sTime& date) const;
+    /*!
+     *  @brief  xf[^t@CɍڂĂ
+     *  @param  date    t(͈͓ł邱)
+     */
+    bool IsHoliday(const garnet::sTime& date) const;
+    /*!
+     *  @brief  ŗLxƓ
+     *  @param  date    t(͈͊Ołǂ)
+     */
+    bool IsJPXHoliday(const garnet::sTime& date) const;
+    /*!
+     *  @brief  ̉cƓ܂ł̓𓾂
+     *  @param  date    t(͈͓ł邱)
+     *  @return (cƓȂ0)
+     *  @note   ͈͖܂ŋxƓꍇ͔͈͊O̍ŏ̓܂ł̓Ԃ(̓ɍĔ肷邱)
+     */
+    int32_t GetDaysToNextOpen(const garnet::sTime& date) const;
+
+private:
+    TradingCalendar(const TradingCalendar&);
+    TradingCalendar(TradingCalendar&&);
+    TradingCalendar& operator= (const TradingCalendar&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
@@ -5,6 +5,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 
 class UpdateMessage;
@@ -51,6 +53,19 @@ public:
      */
     virtual void Update(int64_t tickCount, TradeAssistantSetting& script_mng, UpdateMessage& o_message) = 0;
 
+    /*!
+     *  @brief  UpdateKvȎ𓾂
+     *  @return tickCount(sȂ-1)
+     *  @note   [v͂̎Mʓʒm܂Ŗėǂ
+     */
+    virtual int64_t GetNextUpdateTick() const { return -1; }
+    /*!
+     *  @brief  Mʓʒmݒ
+     *  @param  handler ʒm(http֘AXbhĂ΂)
+     *  @note   ŏUpdateOɐݒ肷邱
+     */
+    virtual void SetWakeUpHandler(const std::function<void()>&) {}
+
 protected:
     TradingMachine();
 
@@ -0,0 +1,216 @@
+/*!
+ *  @file   update_jitter_meter.cpp
+ *  @brief  Update̗h炬v
+ *  @date   2018/01/30
+ */
+#include "update_jitter_meter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+
+namespace trading
+{
+
+UpdateJitterMeter::Statistics::Statistics()
+: m_count(0)
+, m_min_intv_us(0)
+, m_max_intv_us(0)
+, m_total_intv_us(0)
+, m_total_sq_intv_us(0.0)
+, m_total_proc_us(0)
+, m_max_proc_us(0)
+{
+    std::fill(m_histogram, m_histogram + HISTOGRAM_MS + 1, 0);
+}
+
+class UpdateJitterMeter::PIMPL
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    mutable std::mutex m_mtx;       //!< rq(v̓ǂݏo͕ʃXbh痈)
+    Statistics m_stat;              //!< v
+    bool m_b_begin;                 //!< xłBegin
+    clock::time_point m_begin;      //!< ߂UpdateJn
+
+    PIMPL(const PIMPL&);
+    PIMPL(PIMPL&&);
+    PIMPL& operator= (const PIMPL&);
+
+    /*!
+     *  @brief  oߎ[}CNb]
+     */
+    static int64_t ElapsedMicroSeconds(const clock::time_point& begin, const clock::time_point& end)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    }
+
+    /*!
+     *  @brief  ԊuqXgOSʂ𓾂[~b]
+     *  @param  st      v
+     *  @param  ratio   (0.5Ȃ璆l)
+     */
+    static int32_t Percentile(const Statistics& st, float64 ratio)
+    {
+        const int64_t border = static_cast<int64_t>(std::ceil(static_cast<float64>(st.m_count)*ratio));
+        int64_t sum = 0;
+        for (int32_t inx = 0; inx <= HISTOGRAM_MS; inx++) {
+            sum += st.m_histogram[inx];
+            if (sum >= border) {
+                return inx;
+            }
+        }
+        return HISTOGRAM_MS;
+    }
+
+public:
+    PIMPL()
+    : m_mtx()
+    , m_stat()
+    , m_b_begin(false)
+    , m_begin()
+    {
+    }
+
+    /*!
+     *  @brief  UpdateJn
+     */
+    void Begin()
+    {
+        const clock::time_point now = clock::now();
+        if (m_b_begin) {
+            const int64_t intv_us = ElapsedMicroSeconds(m_begin, now);
+            const int32_t bin = static_cast<int32_t>(std::min<int64_t>(intv_us/1000, HISTOGRAM_MS));
+            std::lock_guard<std::mutex> lock(m_mtx);
+            if (m_stat.m_count == 0) {
+                m_stat.m_min_intv_us = intv_us;
+                m_stat.m_max_intv_us = intv_us;
+            } else {
+                m_stat.m_min_intv_us = std::min(m_stat.m_min_intv_us, intv_us);
+                m_stat.m_max_intv_us = std::max(m_stat.m_max_intv_us, intv_us);
+            }
+            m_stat.m_count++;
+            m_stat.m_total_intv_us += intv_us;
+            m_stat.m_total_sq_intv_us += static_cast<float64>(intv_us)*static_cast<float64>(intv_us);
+            m_stat.m_histogram[bin]++;
+        }
+        m_b_begin = true;
+        m_begin = now;
+    }
+
+    /*!
+     *  @brief  UpdateI
+     */
+    void End()
+    {
+        if (!m_b_begin) {
+            return;
+        }
+        const int64_t proc_us = ElapsedMicroSeconds(m_begin, clock::now());
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stat.m_total_proc_us += proc_us;
+        m_stat.m_max_proc_us = std::max(m_stat.m_max_proc_us, proc_us);
+    }
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(Statistics& dst) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        dst = m_stat;
+    }
+
+    /*!
+     *  @brief  vo
+     *  @param  st          v
+     *  @param  filename    o̓t@C
+     */
+    static void OutputStatistics(const Statistics& st, const std::string& filename)
+    {
+        int64_t ave_intv_us = 0;
+        int64_t stddev_intv_us = 0;
+        int64_t ave_proc_us = 0;
+        if (st.m_count > 0) {
+            const float64 ave = static_cast<float64>(st.m_total_intv_us)/static_cast<float64>(st.m_count);
+            const float64 var = st.m_total_sq_intv_us/static_cast<float64>(st.m_count) - ave*ave;
+            ave_intv_us = static_cast<int64_t>(ave);
+            stddev_intv_us = static_cast<int64_t>(std::sqrt(std::max(var, 0.0)));
+            ave_proc_us = st.m_total_proc_us/st.m_count;
+        }
+        std::ofstream outputfile(filename.c_str());
+        outputfile << "count,ave_intv_us,stddev_intv_us,min_intv_us,max_intv_us,p50_intv_ms,p99_intv_ms,p999_intv_ms,ave_proc_us,max_proc_us" << std::endl;
+        outputfile << st.m_count << "," << ave_intv_us << "," << stddev_intv_us << ",";
+        outputfile << st.m_min_intv_us << "," << st.m_max_intv_us << ",";
+        outputfile << Percentile(st, 0.5) << "," << Percentile(st, 0.99) << "," << Percentile(st, 0.999) << ",";
+        outputfile << ave_proc_us << "," << st.m_max_proc_us << std::endl;
+        outputfile << "intv_ms,count" << std::endl;
+        for (int32_t inx = 0; inx <= HISTOGRAM_MS; inx++) {
+            if (st.m_histogram[inx] > 0) {
+                outputfile << inx << "," << st.m_histogram[inx] << std::endl;
+            }
+        }
+        outputfile.close();
+    }
+};
+
+UpdateJitterMeter::UpdateJitterMeter()
+: m_pImpl(new PIMPL())
+{
+}
+
+UpdateJitterMeter::~UpdateJitterMeter()
+{
+}
+
+/*!
+ *  @brief  UpdateJn
+ */
+void UpdateJitterMeter::Begin()
+{
+    m_pImpl->Begin();
+}
+
+/*!
+ *  @brief  UpdateI
+ */
+void UpdateJitterMeter::End()
+{
+    m_pImpl->End();
+}
+
+/*!
+ *  @brief  v擾
+ *  @param[out] dst i[
+ */
+void UpdateJitterMeter::GetStatistics(Statistics& dst) const
+{
+    m_pImpl->GetStatistics(dst);
+}
+
+/*!
+ *  @brief  vo
+ *  @param  filename    o̓t@C
+ */
+void UpdateJitterMeter::OutputLog(const std::string& filename) const
+{
+    Statistics st;
+    m_pImpl->GetStatistics(st);
+    PIMPL::OutputStatistics(st, filename);
+}
+
+/*!
+ *  @brief  vo(static)
+ *  @param  st          v
+ *  @param  filename    o̓t@C
+ */
+void UpdateJitterMeter::OutputStatistics(const Statistics& st, const std::string& filename)
+{
+    PIMPL::OutputStatistics(st, filename);
+}
+
+} // namespace trading
@@ -0,0 +1,88 @@
+/*!
+ *  @file   update_jitter_meter.h
+ *  @brief  Update̗h炬v
+ *  @date   2018/01/30
+ *  @note   Xbhzu(CPUŒ/SCHED_FIFO)̌ʂm߂邽߁AUpdateďoԊuƏԂWv
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace trading
+{
+
+/*!
+ *  @brief  Update̗h炬vNX
+ *  @note   Begin/End͔Xbĥ݌ĂԂ
+ */
+class UpdateJitterMeter
+{
+public:
+    enum
+    {
+        HISTOGRAM_MS = 128, //!< ԊuqXgO͈̔[~b](ȏ͍Ō̋敪ɓ)
+    };
+
+    /*!
+     *  @brief  v
+     */
+    struct Statistics
+    {
+        int64_t m_count;                        //!< Ԋuv
+        int64_t m_min_intv_us;                  //!< ŏԊu[}CNb]
+        int64_t m_max_intv_us;                  //!< őԊu[}CNb]
+        int64_t m_total_intv_us;                //!< Ԋuv[}CNb]
+        float64 m_total_sq_intv_us;             //!< Ԋu捇v(W΍p)
+        int64_t m_total_proc_us;                //!< ԍv[}CNb]
+        int64_t m_max_proc_us;                  //!< ő又[}CNb]
+        int64_t m_histogram[HISTOGRAM_MS + 1];  //!< ԊuqXgO(1~b)
+
+        Statistics();
+    };
+
+    UpdateJitterMeter();
+    ~UpdateJitterMeter();
+
+    /*!
+     *  @brief  UpdateJn
+     *  @note   OJn̊ԊuL^
+     */
+    void Begin();
+    /*!
+     *  @brief  UpdateI
+     *  @note   Jn̏ԂL^
+     */
+    void End();
+
+    /*!
+     *  @brief  v擾
+     *  @param[out] dst i[
+     */
+    void GetStatistics(Statistics& dst) const;
+
+    /*!
+     *  @brief  vo
+     *  @param  filename    o̓t@C
+     *  @note   csv`(1sڂɗvAȍ~ɊԊuqXgO)
+     */
+    void OutputLog(const std::string& filename) const;
+    /*!
+     *  @brief  vo
+     *  @param  st          v(GetStatisticsŎʂ)
+     *  @param  filename    o̓t@C
+     *  @note   OutputLogƓ`/v̓vɐGȂ̂ŕʃXbh珑o
+     */
+    static void OutputStatistics(const Statistics& st, const std::string& filename);
+
+private:
+    UpdateJitterMeter(const UpdateJitterMeter&);
+    UpdateJitterMeter(UpdateJitterMeter&&);
+    UpdateJitterMeter& operator= (const UpdateJitterMeter&);
+
+    class PIMPL;
+    std::unique_ptr<PIMPL> m_pImpl;
+};
+
+} // namespace trading
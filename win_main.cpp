@@ -6,12 +6,15 @@
 
 #include "win_main_struct.h"
 
+#include "allocation_tracker.h"
 #include "environment.h"
+#include "thread_affinity.h"
 #include "trade_assistor.h"
 #include "update_message.h"
 
 #include "utility/utility_datetime.h"
 
+#include <atomic>
 #include <iostream>
 
 class nnStreambuf : public std::wstreambuf {
@@ -103,6 +106,12 @@ int APIENTRY _tWinMain(_In_ HINSTANCE hInstance,
     std::shared_ptr<Environment> environment(Environment::Create());
     std::shared_ptr<trading::TradeAssistor> trade_assistant(std::make_shared<trading::TradeAssistor>());
     g_WinMain.m_TradeAssistor = trade_assistant;
+    // MʂꂽUpdateԊu҂Update(http֘AXbhĂ΂)
+    std::shared_ptr<std::atomic<bool>> b_wakeup(std::make_shared<std::atomic<bool>>(false));
+    trade_assistant->SetWakeUpHandler([b_wakeup]() { b_wakeup->store(true); });
+    // Xbh(̃Xbh)̔zu
+    trading::thread_affinity::CaptureProcessCPU();
+    trading::thread_affinity::ApplyCurrentThread(trading::thread_affinity::ROLE_TRADING);
 
 	// C bZ[W [v:
     MSG msg;
@@ -135,9 +144,14 @@ int APIENTRY _tWinMain(_In_ HINSTANCE hInstance,
                 }
             }
         } else {
-            // ő30t[œ삳Ă݂
+            // Œx30t[œ삳Ă݂(^C}[/Mʓ΂)
             int64_t tickCount = garnet::utility_datetime::GetTickCountGeneral();
-            if (tickCount - prevTickCount >= UPDATE_INTV_MS) {
+            const bool b_new_tick = (tickCount != prevTickCount); // ~bł͉񂵒Ȃ
+            const bool b_posted = b_new_tick && b_wakeup->exchange(false);
+            const int64_t next_tick = trade_assistant->GetNextUpdateTick();
+            const bool b_expired = b_new_tick && (next_tick >= 0 && tickCount >= next_tick);
+            if (tickCount - prevTickCount >= UPDATE_INTV_MS || b_posted || b_expired) {
+                TRADE_ALLOCATION_SCOPE(SECTION_FRAME);
                 UpdateMessage trading_message;
                 trade_assistant->Update(tickCount, trading_message);
                 trading_message.OutputMessage();